@@ -0,0 +1,112 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "atlas.h"
+
+#define HEADER_SIZE 16
+#define ENTRY_SIZE ((3 + ATLAS_MAX_LEVELS) * 4)
+
+static uint32_t read_u32(const unsigned char *bytes) {
+    return bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+}
+
+static int log2_exact(uint32_t value) {
+    if(value == 0 || (value & (value - 1)) != 0) return -1;
+    return __builtin_ctz(value);
+}
+
+static int read_entry(texture_t *tex, const unsigned char *entry, size_t texel_count) {
+    uint32_t width = read_u32(entry);
+    uint32_t height = read_u32(entry + 4);
+    uint32_t levels = read_u32(entry + 8);
+    tex->width_shift = log2_exact(width);
+    tex->height_shift = log2_exact(height);
+    if(tex->width_shift < 0 || tex->height_shift < 0 || width > 32768 || height > 32768) return -1;
+
+    int max_levels = 1 + (tex->width_shift < tex->height_shift ? tex->width_shift : tex->height_shift);
+    if(levels < 1 || levels > ATLAS_MAX_LEVELS || (int)levels > max_levels) return -1;
+
+    tex->width = width;
+    tex->height = height;
+    tex->levels = levels;
+    for(int i = 0; i < tex->levels; i++) {
+        tex->offset[i] = read_u32(entry + 12 + i * 4);
+        size_t level_size = (size_t)(width >> i) * (height >> i);
+        if(tex->offset[i] > texel_count || level_size > texel_count - tex->offset[i]) return -1;
+    }
+    return 0;
+}
+
+int atlas_load(atlas_t *atlas, const char *path) {
+    memset(atlas, 0, sizeof(atlas_t));
+
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) {
+        printf("Failed to open texture atlas %s\n", path);
+        return -1;
+    }
+
+    struct stat st;
+    if(fstat(fd, &st) < 0 || st.st_size < HEADER_SIZE) {
+        printf("%s is not a texture atlas\n", path);
+        close(fd);
+        return -1;
+    }
+
+    atlas->size = st.st_size;
+    atlas->mapping = mmap(NULL, atlas->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(atlas->mapping == MAP_FAILED) {
+        printf("Failed to map texture atlas %s\n", path);
+        atlas->mapping = NULL;
+        return -1;
+    }
+
+    const unsigned char *bytes = atlas->mapping;
+    uint32_t count = read_u32(bytes + 8);
+    uint32_t data = read_u32(bytes + 12);
+    if(memcmp(bytes, ATLAS_MAGIC, 4) != 0 || read_u32(bytes + 4) != ATLAS_VERSION || count == 0 || count > 255 ||
+       data % 64 != 0 || data < HEADER_SIZE + count * ENTRY_SIZE || data > atlas->size) {
+        printf("%s is not a texture atlas\n", path);
+        atlas_free(atlas);
+        return -1;
+    }
+
+    atlas->textures = malloc(count * sizeof(texture_t));
+    if(!atlas->textures) {
+        atlas_free(atlas);
+        return -1;
+    }
+    atlas->count = count;
+    atlas->texels = (const uint32_t *)(bytes + data);
+
+    size_t texel_count = (atlas->size - data) / 4;
+    uint32_t full_levels = texel_count;
+    for(int i = 0; i < atlas->count; i++) {
+        if(read_entry(&atlas->textures[i], bytes + HEADER_SIZE + i * ENTRY_SIZE, texel_count) < 0) {
+            printf("Texture %d in atlas %s is invalid\n", i, path);
+            atlas_free(atlas);
+            return -1;
+        }
+        if(atlas->textures[i].offset[0] < full_levels) full_levels = atlas->textures[i].offset[0];
+    }
+
+    // everything before the first full size level is the small mips, which
+    // distant walls hit every frame
+    madvise(atlas->mapping, data + (size_t)full_levels * 4, MADV_WILLNEED);
+    return 0;
+}
+
+void atlas_free(atlas_t *atlas) {
+    if(atlas->mapping) munmap(atlas->mapping, atlas->size);
+    free(atlas->textures);
+    atlas->mapping = NULL;
+    atlas->textures = NULL;
+    atlas->texels = NULL;
+    atlas->count = 0;
+}
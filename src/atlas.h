@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Texture atlas file, little-endian:
+//   "RCTA", u32 version, u32 count, u32 data offset
+//   count entries of u32 width, height, levels, offset[ATLAS_MAX_LEVELS]
+//   RGBA8 texels, each level row-major, offsets counted in texels from the
+//   data offset. tools/mkatlas writes the small levels of every texture
+//   first so they share a few pages; the full size levels come last.
+#define ATLAS_MAGIC "RCTA"
+#define ATLAS_VERSION 1
+#define ATLAS_MAX_LEVELS 16
+
+typedef struct {
+    int width, height;  // level 0, both powers of two
+    int levels;         // level n is (width >> n) x (height >> n)
+    int width_shift;    // log2(width)
+    int height_shift;
+    uint32_t offset[ATLAS_MAX_LEVELS];
+} texture_t;
+
+typedef struct {
+    int count;
+    texture_t *textures;
+    const uint32_t *texels; // RGBA8, same layout as the framebuffer
+    void *mapping;
+    size_t size;
+} atlas_t;
+
+// Maps the atlas read-only. Small levels are prefetched, full size levels
+// are paged in by the kernel the first time a close wall samples them.
+int atlas_load(atlas_t *atlas, const char *path);
+void atlas_free(atlas_t *atlas);
+
+// Coarsest level that still has at least line_height rows, so a column
+// never skips more than every other texel row.
+static inline int atlas_level(const texture_t *tex, int line_height) {
+    int level = 0;
+    while(level + 1 < tex->levels && (line_height << (level + 1)) <= tex->height) level++;
+    return level;
+}
+
+static inline const texture_t *atlas_texture(const atlas_t *atlas, int type) {
+    return &atlas->textures[(type - 1) % atlas->count];
+}
@@ -0,0 +1,118 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "collision.h"
+#include "utils.h"
+
+int bodies_init(bodies_t *bodies, int capacity) {
+    memset(bodies, 0, sizeof(bodies_t));
+    bodies->x = malloc(capacity * sizeof(float));
+    bodies->y = malloc(capacity * sizeof(float));
+    bodies->dx = calloc(capacity, sizeof(float));
+    bodies->dy = calloc(capacity, sizeof(float));
+    bodies->radius = malloc(capacity * sizeof(float));
+    if(!bodies->x || !bodies->y || !bodies->dx || !bodies->dy || !bodies->radius) {
+        printf("Failed to allocate %d bodies\n", capacity);
+        bodies_free(bodies);
+        return -1;
+    }
+    bodies->capacity = capacity;
+    return 0;
+}
+
+void bodies_free(bodies_t *bodies) {
+    free(bodies->x);
+    free(bodies->y);
+    free(bodies->dx);
+    free(bodies->dy);
+    free(bodies->radius);
+    memset(bodies, 0, sizeof(bodies_t));
+}
+
+int bodies_add(bodies_t *bodies, float x, float y, float radius) {
+    if(bodies->count == bodies->capacity) return -1;
+
+    int i = bodies->count++;
+    bodies->x[i] = x;
+    bodies->y[i] = y;
+    bodies->dx[i] = 0;
+    bodies->dy[i] = 0;
+    bodies->radius[i] = radius;
+    return i;
+}
+
+static float clampf(float value, float low, float high) {
+    return value < low ? low : value > high ? high : value;
+}
+
+// Pushes the circle out of one solid cell along the shortest way out.
+static void push_out(float *x, float *y, float radius, int cell_x, int cell_y) {
+    float left = cell_x * BLOCKS_WIDTH;
+    float top = cell_y * BLOCKS_HEIGHT;
+    float right = left + BLOCKS_WIDTH;
+    float bottom = top + BLOCKS_HEIGHT;
+
+    float offset_x = *x - clampf(*x, left, right);
+    float offset_y = *y - clampf(*y, top, bottom);
+    float distance2 = offset_x * offset_x + offset_y * offset_y;
+    if(distance2 >= radius * radius) return;
+
+    if(distance2 > 0) {
+        // edge or corner contact, slide along the wall's normal
+        float distance = sqrtf(distance2);
+        float push = (radius - distance) / distance;
+        *x += offset_x * push;
+        *y += offset_y * push;
+        return;
+    }
+
+    // centre inside the cell, leave through the nearest face
+    float to_left = *x - left, to_right = right - *x;
+    float to_top = *y - top, to_bottom = bottom - *y;
+    float nearest = fminf(fminf(to_left, to_right), fminf(to_top, to_bottom));
+    if(nearest == to_left) *x = left - radius;
+    else if(nearest == to_right) *x = right + radius;
+    else if(nearest == to_top) *y = top - radius;
+    else *y = bottom + radius;
+}
+
+static void resolve(const map_t *map, float *x, float *y, float radius) {
+    // two passes, a push out of one cell can move into its neighbour
+    for(int pass = 0; pass < 2; pass++) {
+        int x0 = (int)floorf((*x - radius) / BLOCKS_WIDTH);
+        int x1 = (int)floorf((*x + radius) / BLOCKS_WIDTH);
+        int y0 = (int)floorf((*y - radius) / BLOCKS_HEIGHT);
+        int y1 = (int)floorf((*y + radius) / BLOCKS_HEIGHT);
+        for(int cell_y = y0; cell_y <= y1; cell_y++) {
+            for(int cell_x = x0; cell_x <= x1; cell_x++) {
+                if(map_is_wall(map, cell_x, cell_y)) push_out(x, y, radius, cell_x, cell_y);
+            }
+        }
+    }
+}
+
+void collide_move(const map_t *map, float *x, float *y, float dx, float dy, float radius) {
+    float length = sqrtf(dx * dx + dy * dy);
+    float max_step = fminf(radius, BLOCKS_WIDTH / 2.0f);
+    int steps = max_step > 0 ? (int)ceilf(length / max_step) : 1;
+    if(steps < 1) steps = 1;
+
+    float step_x = dx / steps;
+    float step_y = dy / steps;
+    for(int i = 0; i < steps; i++) {
+        *x += step_x;
+        *y += step_y;
+        resolve(map, x, y, radius);
+    }
+}
+
+void collide_bodies(bodies_t *bodies, const map_t *map) {
+    for(int i = 0; i < bodies->count; i++) {
+        if(bodies->dx[i] == 0 && bodies->dy[i] == 0) continue;
+        collide_move(map, &bodies->x[i], &bodies->y[i], bodies->dx[i], bodies->dy[i], bodies->radius[i]);
+        bodies->dx[i] = 0;
+        bodies->dy[i] = 0;
+    }
+}
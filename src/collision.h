@@ -0,0 +1,29 @@
+#pragma once
+
+#include "map.h"
+
+// Moving circles in structure-of-arrays form, so a tick walks each field
+// linearly however many actors there are. Positions and moves are in world
+// units; radii must stay below half a cell to fit through corridors.
+typedef struct {
+    int count;
+    int capacity;
+    float *x;
+    float *y;
+    float *dx;      // move requested for this tick, cleared by collide_bodies
+    float *dy;
+    float *radius;
+} bodies_t;
+
+int bodies_init(bodies_t *bodies, int capacity);
+void bodies_free(bodies_t *bodies);
+// Returns the new body's index, or -1 when full.
+int bodies_add(bodies_t *bodies, float x, float y, float radius);
+
+// Moves a circle by (dx, dy), sliding along any walls it touches. The
+// move is swept in steps shorter than the radius, so nothing tunnels
+// through a wall however fast it goes. Cells outside the map are solid.
+void collide_move(const map_t *map, float *x, float *y, float dx, float dy, float radius);
+
+// Applies every body's pending move the same way.
+void collide_bodies(bodies_t *bodies, const map_t *map);
@@ -0,0 +1,37 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "framebuffer.h"
+
+#define CACHE_LINE 64
+#define ROW_ALIGN (CACHE_LINE / sizeof(uint32_t))
+
+int framebuffer_init(framebuffer_t *fb, int width, int height) {
+    fb->width = width;
+    fb->height = height;
+    fb->stride = (width + ROW_ALIGN - 1) / ROW_ALIGN * ROW_ALIGN;
+
+    size_t size = (size_t)fb->stride * height * sizeof(uint32_t);
+    fb->pixels = aligned_alloc(CACHE_LINE, size);
+    if(!fb->pixels) {
+        printf("Failed to allocate %dx%d framebuffer\n", width, height);
+        return -1;
+    }
+    memset(fb->pixels, 0, size);
+    return 0;
+}
+
+void framebuffer_free(framebuffer_t *fb) {
+    free(fb->pixels);
+    fb->pixels = NULL;
+}
+
+uint32_t framebuffer_checksum(const framebuffer_t *fb) {
+    uint32_t hash = 2166136261u;
+    for(int y = 0; y < fb->height; y++) {
+        const unsigned char *row = (const unsigned char *)(fb->pixels + (size_t)y * fb->stride);
+        for(int i = 0; i < fb->width * 4; i++) hash = (hash ^ row[i]) * 16777619u;
+    }
+    return hash;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdint.h>
+
+// Pixels are stored as RGBA8 in memory order, so the buffer can be handed
+// to glTexSubImage2D as GL_RGBA/GL_UNSIGNED_BYTE without conversion.
+#define RGB(r, g, b) ((uint32_t)(r) | (uint32_t)(g) << 8 | (uint32_t)(b) << 16 | 0xff000000u)
+
+typedef struct {
+    int width;
+    int height;
+    int stride;         // pixels per row, padded to a whole cache line
+    uint32_t *pixels;
+} framebuffer_t;
+
+int framebuffer_init(framebuffer_t *fb, int width, int height);
+void framebuffer_free(framebuffer_t *fb);
+
+// FNV-1a over the visible pixels, for spotting rendering changes.
+uint32_t framebuffer_checksum(const framebuffer_t *fb);
@@ -2,259 +2,364 @@
 #include <GLFW/glfw3.h>
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
+#include "atlas.h"
+#include "map.h"
+#include "minimap.h"
 #include "player.h"
+#include "profiler.h"
+#include "render.h"
+#include "sim.h"
+#include "sprite.h"
+#include "trace.h"
 #include "utils.h"
-#include "textures.h"
 
-void draw_obstacles(int *map) {
-    set_color(200, 50, 50);
-
-    for(int y = 0; y < BLOCKS_Y; y++) {
-        for(int x = 0; x < BLOCKS_X; x++) {
-            if(map[y*BLOCKS_X+x] < 1) continue;
-            glBegin(GL_QUADS);
-
-            glVertex2i(x * BLOCKS_WIDTH, y * BLOCKS_HEIGHT);
-            glVertex2i((x + 1) * BLOCKS_WIDTH, y * BLOCKS_HEIGHT);
-            glVertex2i((x + 1) * BLOCKS_WIDTH, (y + 1) * BLOCKS_HEIGHT);
-            glVertex2i(x * BLOCKS_WIDTH, (y + 1) * BLOCKS_HEIGHT);
-
-            glEnd();
-        }
-    }
+GLuint create_frame_texture(const framebuffer_t *fb) {
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, fb->width, fb->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    return texture;
 }
 
-void draw_map() {
-    set_color(200, 200, 200);
-
-    for(int i = 0; i < BLOCKS_Y; i++) {
-        glBegin(GL_LINES);
-        glVertex2i(0, i * BLOCKS_HEIGHT);
-        glVertex2i(MINIMAP_WIDTH, i * BLOCKS_HEIGHT);
-        glEnd();
-    }
-
-    for(int i = 0; i < BLOCKS_X; i++) {
-        glBegin(GL_LINES);
-        glVertex2i(i * BLOCKS_WIDTH, 0);
-        glVertex2i(i * BLOCKS_WIDTH, MINIMAP_HEIGHT);
-        glEnd();
+// Uploads the software framebuffer, unless told the texture already holds
+// it, and stretches it over the window.
+void present_frame(GLuint texture, const framebuffer_t *fb, int upload) {
+    glBindTexture(GL_TEXTURE_2D, texture);
+    if(upload) {
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, fb->stride);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, fb->width, fb->height, GL_RGBA, GL_UNSIGNED_BYTE, fb->pixels);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
     }
 
-}
-
-void draw_player(player_t *player) {
-    glColor3f(0, 0.8, 0);
-    float left = player->x - player->w / 2.0f;
-    float right = player->x + player->w / 2.0f;
-    float top = player->y - player->h / 2.0f;
-    float bottom = player->y + player->h / 2.0f;
-
+    glEnable(GL_TEXTURE_2D);
+    glColor3f(1, 1, 1);
     glBegin(GL_QUADS);
-    glVertex2f(left, top);
-    glVertex2f(right, top);
-    glVertex2f(right, bottom);
-    glVertex2f(left, bottom);
-
+    glTexCoord2f(0, 0); glVertex2i(0, 0);
+    glTexCoord2f(1, 0); glVertex2i(fb->width, 0);
+    glTexCoord2f(1, 1); glVertex2i(fb->width, fb->height);
+    glTexCoord2f(0, 1); glVertex2i(0, fb->height);
     glEnd();
+    glDisable(GL_TEXTURE_2D);
 }
 
-void draw_rays(player_t *player, int *map_walls, int *map_floor) {
-    int num_rays = 120;
-    float fov = 60 * (M_PI / 180);
-    float start_angle = player->angle - (fov / 2);
-
-    float cell_width = MINIMAP_WIDTH / (float)BLOCKS_X;
-    float cell_height = MINIMAP_HEIGHT / (float)BLOCKS_Y;
+// Hands key changes straight to the simulation attached to the window,
+// which picks them up on its next tick without waiting for a frame.
+void handle_keyboard(GLFWwindow* window, int key, int scancode, int action, int mods) {
+    (void)scancode;
+    (void)mods;
+
+    sim_t *sim = glfwGetWindowUserPointer(window);
+    if(action == GLFW_REPEAT) return;
+
+    input_t input;
+    sim_get_input(sim, &input);
+    int pressed = action == GLFW_PRESS;
+    if(key == GLFW_KEY_W) input.forward = pressed;
+    if(key == GLFW_KEY_S) input.backward = pressed;
+    if(key == GLFW_KEY_A) input.left = pressed;
+    if(key == GLFW_KEY_D) input.right = pressed;
+    sim_set_input(sim, &input);
+
+    if(key == GLFW_KEY_F1 && pressed) {
+        profiler_set_enabled(!atomic_load(&profiler_enabled));
+        if(!atomic_load(&profiler_enabled)) glfwSetWindowTitle(window, "hehe");
+    }
+    if(key == GLFW_KEY_F2 && pressed && profiler_export("profile.json") == 0) {
+        printf("Wrote profile.json\n");
+    }
+}
 
-    int strip_width = WINDOW_WIDTH / num_rays;
+// Frame time graph along the bottom edge with a line at 60 Hz, and one bar
+// per stage above it. GL has no text, so the stage names and times go to
+// the window title in the same top to bottom order.
+void draw_profiler(GLFWwindow *window, int height, double *last_title) {
+    static const unsigned char colors[][3] = {
+        { 230, 80, 80 }, { 80, 200, 80 }, { 80, 140, 230 }, { 230, 200, 60 },
+        { 200, 90, 220 }, { 60, 210, 210 }, { 240, 140, 50 }, { 160, 160, 160 },
+    };
+    const float pixels_per_ms = 8;
+    int bottom = height - 10;
+
+    uint64_t times[PROFILER_FRAMES];
+    int count = profiler_frame_times(times, PROFILER_FRAMES);
+    glBegin(GL_LINES);
+    for(int i = 0; i < count; i++) {
+        float ms = times[i] / 1e6f;
+        if(ms > 1000 / 60.0f) set_color(230, 80, 80);
+        else set_color(80, 200, 80);
+        glVertex2f(10 + i * 3, bottom);
+        glVertex2f(10 + i * 3, bottom - ms * pixels_per_ms);
+    }
+    set_color(255, 255, 255);
+    glVertex2f(10, bottom - 1000 / 60.0f * pixels_per_ms);
+    glVertex2f(10 + PROFILER_FRAMES * 3, bottom - 1000 / 60.0f * pixels_per_ms);
+    glEnd();
 
-    set_color(20, 50, 90);
+    profile_stage_t stages[PROFILER_STAGES];
+    int stage_count = profiler_stages(stages, PROFILER_STAGES);
+    int top = bottom - 40 * pixels_per_ms;
     glBegin(GL_QUADS);
-    glVertex2i(0, 0);
-    glVertex2i(WINDOW_WIDTH, 0);
-    glVertex2i(WINDOW_WIDTH, WINDOW_HEIGHT/2);
-    glVertex2i(0, WINDOW_HEIGHT/2);
+    for(int i = 0; i < stage_count; i++) {
+        const unsigned char *color = colors[i % 8];
+        float width = stages[i].time / 1e6f * pixels_per_ms * 4;
+        int y = top - (stage_count - i) * 14;
+        set_color(color[0], color[1], color[2]);
+        glVertex2f(10, y);
+        glVertex2f(10 + width, y);
+        glVertex2f(10 + width, y + 10);
+        glVertex2f(10, y + 10);
+    }
     glEnd();
 
-    for(int i = 0; i < num_rays; i++) {
-        float ray_angle = start_angle + (i / (float)num_rays) * fov;
-
-        if(ray_angle < 0) ray_angle += 2 * M_PI;
-        if(ray_angle > 2 * M_PI) ray_angle -= 2 * M_PI;
-
-        float rd_x = cos(ray_angle);
-        float rd_y = sin(ray_angle);
-
-        int map_x = player->x / cell_width;
-        int map_y = player->y / cell_height;
-
-        int step_x = (rd_x < 0) ? -1 : 1;
-        int step_y = (rd_y < 0) ? -1 : 1;
-
-        float next_x = (rd_x > 0) ? (map_x + 1) * cell_width : map_x * cell_width;
-        float next_y = (rd_y > 0) ? (map_y + 1) * cell_height : map_y * cell_height;
-
-        float delta_dist_x = fabs(cell_width / (fabs(rd_x) > 0.000001 ? rd_x : 0.000001));
-        float delta_dist_y = fabs(cell_height / (fabs(rd_y) > 0.000001 ? rd_y : 0.000001));
+    double now = glfwGetTime();
+    if(now - *last_title < 0.5) return;
+    *last_title = now;
 
-        float ray_length_x = (next_x - player->x) / (rd_x != 0 ? rd_x : 0.000001);
-        float ray_length_y = (next_y - player->y) / (rd_y != 0 ? rd_y : 0.000001);
-
-        if (rd_x < 0) ray_length_x = (player->x - map_x * cell_width) / fabs(rd_x);
-        if (rd_y < 0) ray_length_y = (player->y - map_y * cell_height) / fabs(rd_y);
-
-        int hit = 0;
-        int hit_side = 0;
-        int wall_type = -1;
-        float ray_distance = 0;
-
-        while(!hit) {
-            if(ray_length_x < ray_length_y) {
-                map_x += step_x;
-                ray_distance = ray_length_x;
-                ray_length_x += delta_dist_x;
-                hit_side = 0;
-            }
-            else {
-                map_y += step_y;
-                ray_distance = ray_length_y;
-                ray_length_y += delta_dist_y;
-                hit_side = 1;
-            }
-
-            if(map_x < 0 || map_x >= BLOCKS_X || map_y < 0 || map_y >= BLOCKS_Y) break;
+    char title[512];
+    int length = snprintf(title, sizeof(title), "hehe");
+    for(int i = 0; i < stage_count && length < (int)sizeof(title); i++) {
+        length += snprintf(title + length, sizeof(title) - length, " | %s %.2f ms", stages[i].name, stages[i].time / 1e6);
+    }
+    glfwSetWindowTitle(window, title);
+}
 
-            wall_type = map_walls[map_y * BLOCKS_X + map_x];
-            if(wall_type > 0) hit = 1;
-        }
+void usage(const char *name) {
+    printf("usage: %s [-t threads] [-w WxH] [-f fov] [-b ms] [-a atlas] [-s atlas] [-n sprites] [-m map | -g size] [-o map] [-r trace]\n", name);
+    printf("  -t threads  render threads, 0 = one per CPU (default)\n");
+    printf("  -w WxH      window and render resolution (default 1800x1200)\n");
+    printf("  -f fov      horizontal field of view in degrees, 0-180 (default 60)\n");
+    printf("  -b ms       drop render quality to hold this render time (default off)\n");
+    printf("  -a atlas    wall texture atlas (default glx/textures.atlas)\n");
+    printf("  -s atlas    sprite texture atlas (default glx/sprites.atlas)\n");
+    printf("  -n sprites  sprites scattered over empty cells (default 8)\n");
+    printf("  -m map      load a map file\n");
+    printf("  -g size     generate a size x size map with random pillars (default 8)\n");
+    printf("  -o map      save the loaded or generated map to a file\n");
+    printf("  -r trace    record key presses to a trace for tools/bench\n");
+    printf("keys: W/S move, A/D turn, F1 profiler overlay, F2 write profile.json\n");
+}
 
-        set_color(50, 100, 100);
-        glBegin(GL_LINES);
-        glVertex2f(player->x, player->y);
-        glVertex2f(player->x + rd_x * ray_distance, player->y + rd_y * ray_distance);
-        glEnd();
-
-        float angle_diff = ray_angle - player->angle;
-        if (angle_diff < 0) angle_diff += 2 * M_PI;
-        if (angle_diff > 2 * M_PI) angle_diff -= 2 * M_PI;
-        float corrected_distance = ray_distance * cos(angle_diff);
-        if (corrected_distance < 0.1f) corrected_distance = 0.1f;
-
-        int line_height = (int)(WINDOW_HEIGHT / corrected_distance * 25);
-        if (line_height > WINDOW_HEIGHT * 3) line_height = WINDOW_HEIGHT * 3;
-        int line_start = (WINDOW_HEIGHT - line_height) / 2;
-
-        int x_start = i * strip_width;
-        float shade = (hit_side == 0) ? 1.0f : 0.7f;
-
-        int texture_x;
-        if (hit_side == 0) {
-            float hit_y = player->y + ray_distance * rd_y;
-            float wall_hit = fmod(hit_y, cell_height) / cell_height;
-            texture_x = (int)(wall_hit * 32);
-            if (rd_x < 0) texture_x = 31 - texture_x;
-        } else {
-            float hit_x = player->x + ray_distance * rd_x;
-            float wall_hit = fmod(hit_x, cell_width) / cell_width;
-            texture_x = (int)(wall_hit * 32);
-            if (rd_y > 0) texture_x = 31 - texture_x;
+int main(int argc, char **argv) {
+    int threads = 0;
+    int width = 1800, height = 1200;
+    float fov = 60;
+    float budget_ms = 0;
+    const char *atlas_path = "glx/textures.atlas";
+    const char *sprite_atlas_path = "glx/sprites.atlas";
+    const char *map_path = NULL;
+    const char *save_path = NULL;
+    const char *trace_path = NULL;
+    int map_size = 8;
+    int sprite_count = 8;
+    int opt;
+    while((opt = getopt(argc, argv, "t:w:f:b:a:s:n:m:g:o:r:h")) != -1) {
+        switch(opt) {
+            case 't': threads = atoi(optarg); break;
+            case 'w':
+                if(sscanf(optarg, "%dx%d", &width, &height) != 2 || width <= 0 || height <= 0) {
+                    printf("Bad resolution %s\n", optarg);
+                    return -1;
+                }
+                break;
+            case 'f':
+                fov = strtof(optarg, NULL);
+                if(!(fov > 0 && fov < 180)) {
+                    printf("Bad field of view %s\n", optarg);
+                    return -1;
+                }
+                break;
+            case 'b': budget_ms = strtof(optarg, NULL); break;
+            case 'a': atlas_path = optarg; break;
+            case 's': sprite_atlas_path = optarg; break;
+            case 'n': sprite_count = atoi(optarg); break;
+            case 'm': map_path = optarg; break;
+            case 'g': map_size = atoi(optarg); break;
+            case 'o': save_path = optarg; break;
+            case 'r': trace_path = optarg; break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : -1;
         }
+    }
 
+    atlas_t atlas;
+    if(atlas_load(&atlas, atlas_path) < 0) return -1;
 
-        glPointSize(strip_width);
-        glBegin(GL_POINTS);
-        for (int y = line_start; y < line_start+line_height; y += strip_width) {
-            int d = y - line_start;
-            int texture_y = ((d * 32) / line_height) % 32;
-            int index = (texture_y * 32 + texture_x) * 3 + (wall_type-1) * 32 * 32 * 3;
-            int r = all_textures[index] * shade;
-            int g = all_textures[index + 1] * shade;
-            int b = all_textures[index + 2] * shade;
-            glColor3ub(r, g, b);
-            glVertex2i(x_start + strip_width / 2, y);
+    map_t map;
+    if(map_path) {
+        if(map_load(&map, map_path) < 0) {
+            atlas_free(&atlas);
+            return -1;
         }
-        glEnd();
-        glPointSize(1.0f);
-
-
-        // draw floor
-
     }
-}
-
-
-
-int main(void) {
-    player_t player = {
-        .x = MINIMAP_WIDTH / 2,
-        .y = MINIMAP_HEIGHT / 2,
-        .w = MINIMAP_WIDTH / 25,
-        .h = MINIMAP_HEIGHT / 25,
-        .angle = M_PI,
-        .dx = 0,
-        .dy = 0
-    };
+    else if(map_generate(&map, map_size, map_size, map_size > 8 ? 0.05f : 0, 1) < 0) {
+        atlas_free(&atlas);
+        return -1;
+    }
+    if(save_path && map_save(&map, save_path) < 0) {
+        map_free(&map);
+        atlas_free(&atlas);
+        return -1;
+    }
 
-    int map_walls[BLOCKS_Y * BLOCKS_X] = {0};
-    for(int i = 0; i < BLOCKS_Y; i++) {
-        for(int j = 0; j < BLOCKS_X; j++) {
-            if(i == 0 || j == 0 || j == BLOCKS_X-1 || i == BLOCKS_Y - 1) {
-                map_walls[i*BLOCKS_X+j] = (i*BLOCKS_X+j) % 20 + 1;
-            }
-        }
+    atlas_t sprite_atlas;
+    if(atlas_load(&sprite_atlas, sprite_atlas_path) < 0) {
+        map_free(&map);
+        atlas_free(&atlas);
+        return -1;
     }
-    int map_floor[BLOCKS_Y * BLOCKS_X] = {0};
-    for(int i = 0; i < BLOCKS_Y; i++) {
-        for(int j = 0; j < BLOCKS_X; j++) {
-            if(i == 0 || j == 0 || j == BLOCKS_X-1 || i == BLOCKS_Y - 1) {
-                map_floor[i*BLOCKS_X+j] = 1;
-            }
-        }
+    sprites_t sprites;
+    if(sprites_init(&sprites, &sprite_atlas, &map, sprite_count) < 0) {
+        atlas_free(&sprite_atlas);
+        map_free(&map);
+        atlas_free(&atlas);
+        return -1;
     }
+    sprites_scatter(&sprites, &map, sprite_count, 0, 1);
 
+    player_t player = {
+        .x = map.width * BLOCKS_WIDTH / 2,
+        .y = map.height * BLOCKS_HEIGHT / 2,
+        .w = BLOCKS_WIDTH * 8 / 25,
+        .h = BLOCKS_HEIGHT * 8 / 25
+    };
+    player_set_angle(&player, M_PI);
 
     if(!glfwInit()) {
         printf("Failed to initialize GLFW\n");
+        sprites_free(&sprites);
+        atlas_free(&sprite_atlas);
+        map_free(&map);
+        atlas_free(&atlas);
         return -1;
     }
 
-    GLFWwindow* window = glfwCreateWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "hehe", NULL, NULL);
+    GLFWwindow* window = glfwCreateWindow(width, height, "hehe", NULL, NULL);
     if (!window) {
         printf("Failed to create GLFW window\n");
         glfwTerminate();
+        sprites_free(&sprites);
+        atlas_free(&sprite_atlas);
+        map_free(&map);
+        atlas_free(&atlas);
         return -1;
     }
 
     glfwMakeContextCurrent(window);
-    glOrtho(0, WINDOW_WIDTH, WINDOW_HEIGHT, 0, -1, 1);
+    glOrtho(0, width, height, 0, -1, 1);
+
+    renderer_t renderer;
+    if(renderer_init(&renderer, &atlas, width, height, threads) < 0) {
+        sprites_free(&sprites);
+        atlas_free(&sprite_atlas);
+        map_free(&map);
+        atlas_free(&atlas);
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
+    renderer.fov = fov * (M_PI / 180);
+    renderer.budget_ms = budget_ms;
+    GLuint frame_texture = create_frame_texture(&renderer.fb);
+
+    minimap_t minimap;
+    if(minimap_init(&minimap) < 0) {
+        glDeleteTextures(1, &frame_texture);
+        renderer_free(&renderer);
+        sprites_free(&sprites);
+        atlas_free(&sprite_atlas);
+        map_free(&map);
+        atlas_free(&atlas);
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
 
     // Set V-Sync (0 = uncapped FPS, 1 = sync to refresh rate)
     glfwSwapInterval(1);
+
+    trace_t trace;
+    trace_init(&trace);
+
+    sim_t sim;
+    if(sim_start(&sim, &map, &player, trace_path ? &trace : NULL) < 0) {
+        minimap_free(&minimap);
+        glDeleteTextures(1, &frame_texture);
+        renderer_free(&renderer);
+        sprites_free(&sprites);
+        atlas_free(&sprite_atlas);
+        map_free(&map);
+        atlas_free(&atlas);
+        glfwDestroyWindow(window);
+        glfwTerminate();
+        return -1;
+    }
+    glfwSetWindowUserPointer(window, &sim);
     glfwSetKeyCallback(window, handle_keyboard);
 
-    float last_time = glfwGetTime();
+    double last_title = 0;
     while (!glfwWindowShouldClose(window)) {
-        float current_time = glfwGetTime();
-        float d_time = current_time - last_time;
-        last_time = current_time;
+        profiler_frame();
 
         glClear(GL_COLOR_BUFFER_BIT);
         glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
 
-        draw_rays(&player, map_walls, map_floor);
-        draw_obstacles(map_walls);
-        draw_player(&player);
-        draw_map();
-
-        handle_movement(&player, map_walls, d_time);
+        // movement runs on the simulation thread, the frame only samples it
+        player_t view;
+        sim_interpolate(&sim, &view);
+
+        uint64_t stage = profile_begin();
+        double render_start = glfwGetTime();
+        render_frame(&renderer, &view, &map, &sprites);
+        // a skipped frame costs nothing and says nothing about the level
+        if(!renderer.unchanged) renderer_adapt(&renderer, (glfwGetTime() - render_start) * 1e3);
+        profile_end("render", stage);
+
+        stage = profile_begin();
+        // a skipped frame left the texture holding it already
+        present_frame(frame_texture, &renderer.fb, !renderer.unchanged);
+        profile_end("present", stage);
+
+        stage = profile_begin();
+        minimap_draw(&minimap, &map, &renderer, &view);
+        profile_end("minimap", stage);
+
+        if(atomic_load_explicit(&profiler_enabled, memory_order_relaxed)) {
+            stage = profile_begin();
+            draw_profiler(window, height, &last_title);
+            profile_end("overlay", stage);
+        }
 
+        // with V-Sync on, this is where the frame waits for the display
+        stage = profile_begin();
         glfwSwapBuffers(window);
+        profile_end("swap", stage);
+
+        stage = profile_begin();
         glfwPollEvents();
+        profile_end("events", stage);
     }
 
+    sim_stop(&sim);
+    if(trace_path) {
+        trace_end(&trace, sim_time(&sim));
+        trace_save(&trace, trace_path);
+    }
+    trace_free(&trace);
+
+    minimap_free(&minimap);
+    glDeleteTextures(1, &frame_texture);
+    renderer_free(&renderer);
+    sprites_free(&sprites);
+    atlas_free(&sprite_atlas);
+    map_free(&map);
+    atlas_free(&atlas);
     glfwDestroyWindow(window);
     glfwTerminate();
     return 0;
@@ -0,0 +1,208 @@
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "map.h"
+
+#define MAP_MAGIC "RCMP"
+#define MAP_MAX_SIZE 65536
+// floor texture of generated maps, the checkered tiles
+#define GENERATED_FLOOR 12
+
+// One counter for every map, so a map loaded into the struct of a freed
+// one never repeats a version a cache has already seen.
+static atomic_uint map_versions;
+
+static unsigned next_version(void) {
+    return atomic_fetch_add(&map_versions, 1) + 1;
+}
+
+int map_init(map_t *map, int width, int height) {
+    memset(map, 0, sizeof(map_t));
+    map->version = next_version();
+    if(width <= 0 || height <= 0 || width > MAP_MAX_SIZE || height > MAP_MAX_SIZE) {
+        printf("Invalid map size %dx%d\n", width, height);
+        return -1;
+    }
+
+    map->width = width;
+    map->height = height;
+    map->tiles_x = (width + MAP_TILE_MASK) >> MAP_TILE_SHIFT;
+    map->tiles_y = (height + MAP_TILE_MASK) >> MAP_TILE_SHIFT;
+    map->regions_x = (map->tiles_x + MAP_TILE_MASK) >> MAP_TILE_SHIFT;
+    map->regions_y = (map->tiles_y + MAP_TILE_MASK) >> MAP_TILE_SHIFT;
+
+    size_t tiles = (size_t)map->tiles_x * map->tiles_y;
+    map->walls = calloc(tiles, MAP_TILE_CELLS);
+    map->floors = calloc(tiles, MAP_TILE_CELLS);
+    map->occupancy = calloc(tiles, sizeof(uint64_t));
+    map->regions = calloc((size_t)map->regions_x * map->regions_y, sizeof(uint64_t));
+    if(!map->walls || !map->floors || !map->occupancy || !map->regions) {
+        printf("Failed to allocate %dx%d map\n", width, height);
+        map_free(map);
+        return -1;
+    }
+    return 0;
+}
+
+void map_free(map_t *map) {
+    free(map->walls);
+    free(map->floors);
+    free(map->occupancy);
+    free(map->regions);
+    map->walls = NULL;
+    map->floors = NULL;
+    map->occupancy = NULL;
+    map->regions = NULL;
+}
+
+// Unversioned setters for filling a whole map, which takes one version at
+// the end instead of one per cell.
+static void store_wall(map_t *map, int x, int y, int type) {
+    size_t index = map_index(map, x, y);
+    uint64_t bit = 1ull << (index & (MAP_TILE_CELLS - 1));
+    uint64_t *word = &map->occupancy[map_tile(map, x, y)];
+
+    map->walls[index] = type;
+    if(type > 0) *word |= bit;
+    else *word &= ~bit;
+
+    // only the one region bit above this tile can change
+    uint64_t tile_bit = 1ull << map_region_bit(x, y);
+    if(*word) map->regions[map_region(map, x, y)] |= tile_bit;
+    else map->regions[map_region(map, x, y)] &= ~tile_bit;
+}
+
+static void store_floor(map_t *map, int x, int y, int type) {
+    map->floors[map_index(map, x, y)] = type;
+}
+
+void map_set_wall(map_t *map, int x, int y, int type) {
+    if(!map_in_bounds(map, x, y)) return;
+    store_wall(map, x, y, type);
+    map->version = next_version();
+}
+
+void map_set_floor(map_t *map, int x, int y, int type) {
+    if(!map_in_bounds(map, x, y)) return;
+    store_floor(map, x, y, type);
+    map->version = next_version();
+}
+
+static uint32_t read_u32(const unsigned char *bytes) {
+    return bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+}
+
+static void write_u32(unsigned char *bytes, uint32_t value) {
+    bytes[0] = value;
+    bytes[1] = value >> 8;
+    bytes[2] = value >> 16;
+    bytes[3] = value >> 24;
+}
+
+static int read_layer(map_t *map, FILE *file, int walls, unsigned char *row) {
+    for(int y = 0; y < map->height; y++) {
+        if(fread(row, 1, map->width, file) != (size_t)map->width) return -1;
+        for(int x = 0; x < map->width; x++) {
+            if(walls) store_wall(map, x, y, row[x]);
+            else store_floor(map, x, y, row[x]);
+        }
+    }
+    return 0;
+}
+
+int map_load(map_t *map, const char *path) {
+    FILE *file = fopen(path, "rb");
+    if(!file) {
+        printf("Failed to open map %s\n", path);
+        return -1;
+    }
+
+    unsigned char header[12];
+    if(fread(header, 1, sizeof(header), file) != sizeof(header) || memcmp(header, MAP_MAGIC, 4) != 0) {
+        printf("%s is not a map file\n", path);
+        fclose(file);
+        return -1;
+    }
+
+    uint32_t width = read_u32(header + 4);
+    uint32_t height = read_u32(header + 8);
+    if(width > MAP_MAX_SIZE || height > MAP_MAX_SIZE || map_init(map, width, height) < 0) {
+        fclose(file);
+        return -1;
+    }
+
+    unsigned char *row = malloc(width);
+    if(!row || read_layer(map, file, 1, row) < 0 || read_layer(map, file, 0, row) < 0) {
+        printf("Map %s is truncated\n", path);
+        free(row);
+        fclose(file);
+        map_free(map);
+        return -1;
+    }
+
+    free(row);
+    fclose(file);
+    map->version = next_version();
+    return 0;
+}
+
+int map_save(const map_t *map, const char *path) {
+    FILE *file = fopen(path, "wb");
+    if(!file) {
+        printf("Failed to create map %s\n", path);
+        return -1;
+    }
+
+    unsigned char header[12];
+    memcpy(header, MAP_MAGIC, 4);
+    write_u32(header + 4, map->width);
+    write_u32(header + 8, map->height);
+    int ok = fwrite(header, 1, sizeof(header), file) == sizeof(header);
+
+    unsigned char *row = malloc(map->width);
+    if(!row) {
+        fclose(file);
+        return -1;
+    }
+    for(int layer = 0; layer < 2 && ok; layer++) {
+        for(int y = 0; y < map->height && ok; y++) {
+            for(int x = 0; x < map->width; x++) {
+                row[x] = layer == 0 ? map_get_wall(map, x, y) : map_get_floor(map, x, y);
+            }
+            ok = fwrite(row, 1, map->width, file) == (size_t)map->width;
+        }
+    }
+    free(row);
+
+    if(fclose(file) != 0) ok = 0;
+    if(!ok) {
+        printf("Failed to write map %s\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+int map_generate(map_t *map, int width, int height, float fill, unsigned seed) {
+    if(map_init(map, width, height) < 0) return -1;
+
+    srand(seed);
+    for(int y = 0; y < height; y++) {
+        for(int x = 0; x < width; x++) {
+            int border = y == 0 || x == 0 || x == width - 1 || y == height - 1;
+            int near_centre = abs(x - width / 2) <= 1 && abs(y - height / 2) <= 1;
+
+            if(border) {
+                store_wall(map, x, y, (y * width + x) % 20 + 1);
+                store_floor(map, x, y, 1);
+            }
+            else {
+                store_floor(map, x, y, GENERATED_FLOOR);
+                if(!near_centre && rand() < fill * RAND_MAX) store_wall(map, x, y, rand() % 20 + 1);
+            }
+        }
+    }
+    map->version = next_version();
+    return 0;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Cells are stored in 8x8 tiles, tiles in row-major order, so a ray
+// stepping a few cells in any direction stays inside one or two cache
+// lines. Each tile also has a 64-bit occupancy word with one bit per
+// cell, which turns the "is this a wall" test into a single bit probe.
+#define MAP_TILE_SHIFT 3
+#define MAP_TILE_SIZE (1 << MAP_TILE_SHIFT)
+#define MAP_TILE_MASK (MAP_TILE_SIZE - 1)
+#define MAP_TILE_CELLS (MAP_TILE_SIZE * MAP_TILE_SIZE)
+
+// Second occupancy level: one bit per tile, set while the tile has any
+// wall, one word per 8x8 tiles (64x64 cells). Rays use both levels to
+// skip empty space.
+#define MAP_REGION_SHIFT (2 * MAP_TILE_SHIFT)
+
+typedef struct {
+    int width;
+    int height;
+    int tiles_x;
+    int tiles_y;
+    uint8_t *walls;         // wall texture per cell, 0 = empty
+    uint8_t *floors;        // floor texture per cell, 0 = none
+    uint64_t *occupancy;    // bit set for every cell with a wall
+    int regions_x;
+    int regions_y;
+    uint64_t *regions;      // bit set for every tile with a wall
+    unsigned version;       // changes on every edit and load
+} map_t;
+
+int map_init(map_t *map, int width, int height);
+void map_free(map_t *map);
+
+// Binary map file: "RCMP", u32 width, u32 height (little endian), then
+// width*height wall bytes and width*height floor bytes in row-major order.
+int map_load(map_t *map, const char *path);
+int map_save(const map_t *map, const char *path);
+
+// Walled border like the original 8x8 level, plus random pillars covering
+// roughly `fill` of the interior (0..1). The area around the centre is
+// kept clear for the player.
+int map_generate(map_t *map, int width, int height, float fill, unsigned seed);
+
+void map_set_wall(map_t *map, int x, int y, int type);
+void map_set_floor(map_t *map, int x, int y, int type);
+
+static inline size_t map_tile(const map_t *map, int x, int y) {
+    return (size_t)(y >> MAP_TILE_SHIFT) * map->tiles_x + (x >> MAP_TILE_SHIFT);
+}
+
+static inline size_t map_index(const map_t *map, int x, int y) {
+    return map_tile(map, x, y) << (2 * MAP_TILE_SHIFT) | (size_t)(y & MAP_TILE_MASK) << MAP_TILE_SHIFT | (x & MAP_TILE_MASK);
+}
+
+static inline int map_in_bounds(const map_t *map, int x, int y) {
+    return x >= 0 && y >= 0 && x < map->width && y < map->height;
+}
+
+// Unchecked occupancy probe, the caller keeps (x, y) inside the map.
+static inline int map_solid(const map_t *map, int x, int y) {
+    size_t index = map_index(map, x, y);
+    return (map->occupancy[index >> (2 * MAP_TILE_SHIFT)] >> (index & (MAP_TILE_CELLS - 1))) & 1;
+}
+
+// Checked variant; everything outside the map counts as wall.
+static inline int map_is_wall(const map_t *map, int x, int y) {
+    return !map_in_bounds(map, x, y) || map_solid(map, x, y);
+}
+
+static inline size_t map_region(const map_t *map, int x, int y) {
+    return (size_t)(y >> MAP_REGION_SHIFT) * map->regions_x + (x >> MAP_REGION_SHIFT);
+}
+
+// Bit of the tile containing (x, y) inside its region word.
+static inline int map_region_bit(int x, int y) {
+    return ((y >> MAP_TILE_SHIFT) & MAP_TILE_MASK) << MAP_TILE_SHIFT | ((x >> MAP_TILE_SHIFT) & MAP_TILE_MASK);
+}
+
+static inline int map_get_wall(const map_t *map, int x, int y) {
+    return map->walls[map_index(map, x, y)];
+}
+
+static inline int map_get_floor(const map_t *map, int x, int y) {
+    return map->floors[map_index(map, x, y)];
+}
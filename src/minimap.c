@@ -0,0 +1,150 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "framebuffer.h"
+#include "minimap.h"
+#include "utils.h"
+
+#define MINIMAP_X 10
+#define MINIMAP_Y 10
+#define TEXTURE_SIZE (MINIMAP_CACHE * MINIMAP_TEXELS)
+
+#define WALL_COLOR RGB(200, 50, 50)
+#define GRID_COLOR RGB(200, 200, 200)
+
+int minimap_init(minimap_t *minimap) {
+    memset(minimap, 0, sizeof(minimap_t));
+    minimap->pixels = malloc(TEXTURE_SIZE * TEXTURE_SIZE * sizeof(uint32_t));
+    if(!minimap->pixels) {
+        printf("Failed to allocate minimap\n");
+        return -1;
+    }
+
+    glGenTextures(1, &minimap->texture);
+    glBindTexture(GL_TEXTURE_2D, minimap->texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, TEXTURE_SIZE, TEXTURE_SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    return 0;
+}
+
+void minimap_free(minimap_t *minimap) {
+    glDeleteTextures(1, &minimap->texture);
+    free(minimap->pixels);
+    minimap->pixels = NULL;
+}
+
+// Redraws the cached cells starting at the origin. Empty cells stay
+// transparent so the 3D view shows through, like the old line drawing.
+static void rebuild(minimap_t *minimap, const map_t *map) {
+    memset(minimap->pixels, 0, TEXTURE_SIZE * TEXTURE_SIZE * sizeof(uint32_t));
+
+    for(int cy = 0; cy < MINIMAP_CACHE; cy++) {
+        int y = minimap->origin_y + cy;
+        if(y >= map->height) break;
+        for(int cx = 0; cx < MINIMAP_CACHE; cx++) {
+            int x = minimap->origin_x + cx;
+            if(x >= map->width) break;
+
+            uint32_t *cell = minimap->pixels + (size_t)cy * MINIMAP_TEXELS * TEXTURE_SIZE + cx * MINIMAP_TEXELS;
+            uint32_t fill = map_solid(map, x, y) ? WALL_COLOR : 0;
+            for(int ty = 0; ty < MINIMAP_TEXELS; ty++) {
+                for(int tx = 0; tx < MINIMAP_TEXELS; tx++) {
+                    cell[ty * TEXTURE_SIZE + tx] = (tx == 0 || ty == 0) ? GRID_COLOR : fill;
+                }
+            }
+        }
+    }
+
+    glBindTexture(GL_TEXTURE_2D, minimap->texture);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, TEXTURE_SIZE, TEXTURE_SIZE, GL_RGBA, GL_UNSIGNED_BYTE, minimap->pixels);
+
+    minimap->map = map;
+    minimap->version = map->version;
+}
+
+// First visible cell on one axis: centred on the player, kept inside the map.
+static float view_start(float player, int view, int size) {
+    float start = player - view / 2.0f;
+    if(start > size - view) start = size - view;
+    if(start < 0) start = 0;
+    return start;
+}
+
+static void draw_ray_fan(const renderer_t *renderer, const player_t *player) {
+    // one line per 120th of the screen, like the old strip renderer
+    int step = renderer->fb.width / 120;
+    if(step < 1) step = 1;
+
+    set_color(50, 100, 100);
+    glBegin(GL_LINES);
+    for(int i = 0; i < renderer->fb.width; i += step) {
+        const ray_hit_t *hit = &renderer->hits[i];
+        glVertex2f(player->x, player->y);
+        glVertex2f(player->x + hit->dir_x * hit->distance, player->y + hit->dir_y * hit->distance);
+    }
+    glEnd();
+}
+
+static void draw_player(const player_t *player) {
+    float left = player->x - player->w / 2.0f;
+    float right = player->x + player->w / 2.0f;
+    float top = player->y - player->h / 2.0f;
+    float bottom = player->y + player->h / 2.0f;
+
+    glColor3f(0, 0.8, 0);
+    glBegin(GL_QUADS);
+    glVertex2f(left, top);
+    glVertex2f(right, top);
+    glVertex2f(right, bottom);
+    glVertex2f(left, bottom);
+    glEnd();
+}
+
+void minimap_draw(minimap_t *minimap, const map_t *map, const renderer_t *renderer, const player_t *player) {
+    int view_w = MIN(MINIMAP_VIEW, map->width);
+    int view_h = MIN(MINIMAP_VIEW, map->height);
+    float start_x = view_start(player->x / (float)BLOCKS_WIDTH, view_w, map->width);
+    float start_y = view_start(player->y / (float)BLOCKS_HEIGHT, view_h, map->height);
+
+    int origin_x = (int)start_x / MINIMAP_SNAP * MINIMAP_SNAP;
+    int origin_y = (int)start_y / MINIMAP_SNAP * MINIMAP_SNAP;
+    if(minimap->map != map || minimap->version != map->version || minimap->origin_x != origin_x || minimap->origin_y != origin_y) {
+        minimap->origin_x = origin_x;
+        minimap->origin_y = origin_y;
+        rebuild(minimap, map);
+    }
+
+    int width = view_w * MINIMAP_CELL_PIXELS;
+    int height = view_h * MINIMAP_CELL_PIXELS;
+    float u = (start_x - origin_x) / MINIMAP_CACHE;
+    float v = (start_y - origin_y) / MINIMAP_CACHE;
+    float du = view_w / (float)MINIMAP_CACHE;
+    float dv = view_h / (float)MINIMAP_CACHE;
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, minimap->texture);
+    glColor3f(1, 1, 1);
+    glBegin(GL_QUADS);
+    glTexCoord2f(u, v); glVertex2i(MINIMAP_X, MINIMAP_Y);
+    glTexCoord2f(u + du, v); glVertex2i(MINIMAP_X + width, MINIMAP_Y);
+    glTexCoord2f(u + du, v + dv); glVertex2i(MINIMAP_X + width, MINIMAP_Y + height);
+    glTexCoord2f(u, v + dv); glVertex2i(MINIMAP_X, MINIMAP_Y + height);
+    glEnd();
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_BLEND);
+
+    // fan and player stay in world units, mapped onto the visible cells
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(MINIMAP_X, renderer->fb.height - MINIMAP_Y - height, width, height);
+    glPushMatrix();
+    glTranslatef(MINIMAP_X - start_x * MINIMAP_CELL_PIXELS, MINIMAP_Y - start_y * MINIMAP_CELL_PIXELS, 0);
+    glScalef(MINIMAP_CELL_PIXELS / (float)BLOCKS_WIDTH, MINIMAP_CELL_PIXELS / (float)BLOCKS_HEIGHT, 1);
+    draw_ray_fan(renderer, player);
+    draw_player(player);
+    glPopMatrix();
+    glDisable(GL_SCISSOR_TEST);
+}
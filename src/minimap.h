@@ -0,0 +1,34 @@
+#pragma once
+
+#include <GL/gl.h>
+#include <stdint.h>
+
+#include "map.h"
+#include "player.h"
+#include "render.h"
+
+// Cells shown around the player and their size on screen.
+#define MINIMAP_VIEW 32
+#define MINIMAP_CELL_PIXELS 15
+// Texels per cell in the cached layer, the first row and column are grid.
+#define MINIMAP_TEXELS 8
+// The cached layer starts on multiples of this many cells, so walking
+// only rebuilds it after crossing a snap boundary.
+#define MINIMAP_SNAP 8
+#define MINIMAP_CACHE (MINIMAP_VIEW + MINIMAP_SNAP)
+
+typedef struct {
+    GLuint texture;
+    uint32_t *pixels;   // MINIMAP_CACHE * MINIMAP_TEXELS texels square
+    const map_t *map;   // what the cached layer was built from
+    unsigned version;
+    int origin_x, origin_y;
+} minimap_t;
+
+// Needs a current GL context.
+int minimap_init(minimap_t *minimap);
+void minimap_free(minimap_t *minimap);
+
+// Draws walls and grid from the cached layer, then the ray fan and the
+// player in one batch each, clipped to the minimap.
+void minimap_draw(minimap_t *minimap, const map_t *map, const renderer_t *renderer, const player_t *player);
@@ -1,19 +1,39 @@
 #pragma once
 
-#include <GLFW/glfw3.h>
+#include "map.h"
+
 #define MOVE_SPEED 150.0f
 #define ROTATION_SPEED 2.5f
-#define COLLISION_BUFFER 00.0f
+// Clearance kept between the player's body and the walls, in world units.
+#define COLLISION_BUFFER 2.0f
 
 typedef struct {
-    int x;
-    int y;
+    float x;        // centre in world units
+    float y;
     int w;
     int h;
     float angle;
-    float dx;
-    float dy;
+    float dir_x;    // unit view direction, kept in sync with angle
+    float dir_y;
 } player_t;
 
-void handle_keyboard(GLFWwindow* window, int key, int scancode, int action, int mods);
-void handle_movement(player_t *player, int map[], float d_time);
+// Held movement keys. Filled from GLFW in the game and from a recorded
+// trace in the benchmark, so movement code never sees the window.
+typedef struct {
+    int forward;
+    int backward;
+    int left;
+    int right;
+} input_t;
+
+// Sets the view angle and refreshes the direction vector. The only place
+// player trig runs, so it costs nothing while the player is not turning.
+void player_set_angle(player_t *player, float angle);
+
+static inline float player_radius(const player_t *player) {
+    return player->w / 2.0f + COLLISION_BUFFER;
+}
+
+// Turns and moves by one step of input. Keeps no state of its own, so any
+// number of players can be simulated side by side.
+void handle_movement(player_t *player, const input_t *input, const map_t *map, float d_time);
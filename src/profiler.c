@@ -0,0 +1,213 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "profiler.h"
+
+// Single writer ring: the owning thread fills the slot, then publishes it
+// by bumping head. Readers copy a window and re-read head afterwards to
+// drop anything the writer may have lapped in the meantime. When a thread
+// exits its ring is released and the next new thread takes it over, old
+// events included, so pools created and destroyed over and over never
+// run out of slots.
+typedef struct {
+    atomic_uint_fast64_t head;
+    atomic_int owned;
+    int id;
+    profile_event_t events[PROFILER_EVENTS];
+} ring_t;
+
+atomic_int profiler_enabled;
+
+static _Atomic(ring_t *) rings[PROFILER_THREADS];
+static atomic_int ring_count;
+static _Thread_local ring_t *thread_ring;
+static _Thread_local int thread_dropped;
+static pthread_key_t ring_key;
+static pthread_once_t ring_key_once = PTHREAD_ONCE_INIT;
+
+// frame start times, written only by the main thread
+static uint64_t frames[PROFILER_FRAMES];
+static int frame_count;
+
+uint64_t profiler_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static ring_t *ring_at(int index) {
+    return atomic_load_explicit(&rings[index], memory_order_acquire);
+}
+
+static int thread_count(void) {
+    int count = atomic_load_explicit(&ring_count, memory_order_relaxed);
+    return count < PROFILER_THREADS ? count : PROFILER_THREADS;
+}
+
+// pthread key destructor, runs when a recording thread exits
+static void release_ring(void *ring) {
+    atomic_store_explicit(&((ring_t *)ring)->owned, 0, memory_order_release);
+}
+
+static void create_ring_key(void) {
+    pthread_key_create(&ring_key, release_ring);
+}
+
+static ring_t *claim_free_ring(void) {
+    for(int t = 0; t < thread_count(); t++) {
+        ring_t *ring = ring_at(t);
+        int expected = 0;
+        if(ring && atomic_compare_exchange_strong_explicit(&ring->owned, &expected, 1, memory_order_acquire, memory_order_relaxed)) return ring;
+    }
+    return NULL;
+}
+
+static ring_t *register_thread(void) {
+    if(thread_dropped) return NULL;
+    pthread_once(&ring_key_once, create_ring_key);
+
+    ring_t *ring = claim_free_ring();
+    if(!ring) {
+        int id = atomic_fetch_add_explicit(&ring_count, 1, memory_order_relaxed);
+        ring = id < PROFILER_THREADS ? calloc(1, sizeof(ring_t)) : NULL;
+        if(!ring) {
+            // too many live threads, this one just goes unrecorded
+            thread_dropped = 1;
+            return NULL;
+        }
+        ring->id = id;
+        atomic_init(&ring->owned, 1);
+        atomic_store_explicit(&rings[id], ring, memory_order_release);
+    }
+    pthread_setspecific(ring_key, ring);
+    thread_ring = ring;
+    return ring;
+}
+
+void profile_record(const char *name, uint64_t begin, uint64_t end) {
+    ring_t *ring = thread_ring ? thread_ring : register_thread();
+    if(!ring) return;
+
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    profile_event_t *event = &ring->events[head & (PROFILER_EVENTS - 1)];
+    event->name = name;
+    event->begin = begin;
+    event->end = end;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+void profiler_set_enabled(int enabled) {
+    // the frame graph restarts so the disabled gap is not shown as a frame
+    if(enabled) frame_count = 0;
+    atomic_store_explicit(&profiler_enabled, enabled, memory_order_relaxed);
+}
+
+void profiler_frame(void) {
+    if(!atomic_load_explicit(&profiler_enabled, memory_order_relaxed)) return;
+    frames[frame_count % PROFILER_FRAMES] = profiler_now();
+    frame_count++;
+}
+
+int profiler_frame_times(uint64_t *times, int count) {
+    int available = frame_count - 1;
+    if(available > PROFILER_FRAMES - 1) available = PROFILER_FRAMES - 1;
+    if(count > available) count = available;
+
+    for(int i = 0; i < count; i++) {
+        int frame = frame_count - count + i;
+        times[i] = frames[frame % PROFILER_FRAMES] - frames[(frame - 1) % PROFILER_FRAMES];
+    }
+    return count;
+}
+
+// Copies the events still held in a ring, returns how many.
+static int read_ring(ring_t *ring, profile_event_t *events) {
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    uint64_t first = head > PROFILER_EVENTS ? head - PROFILER_EVENTS : 0;
+    for(uint64_t i = first; i < head; i++) events[i - first] = ring->events[i & (PROFILER_EVENTS - 1)];
+
+    uint64_t after = atomic_load_explicit(&ring->head, memory_order_acquire);
+    // the writer may already be filling slot `after`, which holds entry
+    // after - PROFILER_EVENTS, so that one is lost too
+    uint64_t valid = after + 1 > PROFILER_EVENTS ? after + 1 - PROFILER_EVENTS : 0;
+    if(valid <= first) return head - first;
+    if(valid >= head) return 0;
+
+    int lapped = valid - first;
+    for(uint64_t i = 0; i < head - valid; i++) events[i] = events[i + lapped];
+    return head - valid;
+}
+
+int profiler_stages(profile_stage_t *stages, int count) {
+    if(frame_count < 2) return 0;
+    uint64_t start = frames[(frame_count - 2) % PROFILER_FRAMES];
+    uint64_t end = frames[(frame_count - 1) % PROFILER_FRAMES];
+
+    profile_event_t *events = malloc(PROFILER_EVENTS * sizeof(profile_event_t));
+    if(!events) return 0;
+
+    int used = 0;
+    for(int t = 0; t < thread_count(); t++) {
+        ring_t *ring = ring_at(t);
+        if(!ring) continue;
+
+        int n = read_ring(ring, events);
+        for(int i = 0; i < n; i++) {
+            if(events[i].begin < start || events[i].begin >= end) continue;
+
+            int s = 0;
+            while(s < used && stages[s].name != events[i].name) s++;
+            if(s == used) {
+                if(used == count) continue;
+                stages[used].name = events[i].name;
+                stages[used].time = 0;
+                used++;
+            }
+            stages[s].time += events[i].end - events[i].begin;
+        }
+    }
+
+    free(events);
+    return used;
+}
+
+int profiler_export(const char *path) {
+    FILE *file = fopen(path, "w");
+    if(!file) {
+        printf("Failed to create profile %s\n", path);
+        return -1;
+    }
+
+    profile_event_t *events = malloc(PROFILER_EVENTS * sizeof(profile_event_t));
+    if(!events) {
+        fclose(file);
+        return -1;
+    }
+
+    fprintf(file, "{\"traceEvents\":[\n");
+    int first = 1;
+    for(int t = 0; t < thread_count(); t++) {
+        ring_t *ring = ring_at(t);
+        if(!ring) continue;
+
+        fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+            first ? "" : ",\n", ring->id, ring->id);
+        first = 0;
+
+        int n = read_ring(ring, events);
+        for(int i = 0; i < n; i++) {
+            fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                events[i].name, ring->id, events[i].begin / 1000.0, (events[i].end - events[i].begin) / 1000.0);
+        }
+    }
+    fprintf(file, "\n]}\n");
+    free(events);
+
+    if(fclose(file) != 0) {
+        printf("Failed to write profile %s\n", path);
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+// Scoped stage timing. Each thread writes into its own ring, so recording
+// takes no lock; while disabled a scope costs one relaxed load.
+//
+//   uint64_t t = profile_begin();
+//   render_frame(...);
+//   profile_end("render", t);
+//
+// Stage names must be string literals, they are compared by address.
+
+#define PROFILER_THREADS 64
+#define PROFILER_EVENTS 16384   // per thread, power of two
+#define PROFILER_FRAMES 256     // frame times kept for the graph
+#define PROFILER_STAGES 16
+
+typedef struct {
+    const char *name;
+    uint64_t begin;     // ns, CLOCK_MONOTONIC
+    uint64_t end;
+} profile_event_t;
+
+typedef struct {
+    const char *name;
+    uint64_t time;      // ns summed over every thread
+} profile_stage_t;
+
+extern atomic_int profiler_enabled;
+
+uint64_t profiler_now(void);
+
+static inline uint64_t profile_begin(void) {
+    return atomic_load_explicit(&profiler_enabled, memory_order_relaxed) ? profiler_now() : 0;
+}
+
+void profile_record(const char *name, uint64_t begin, uint64_t end);
+
+static inline void profile_end(const char *name, uint64_t begin) {
+    if(begin) profile_record(name, begin, profiler_now());
+}
+
+void profiler_set_enabled(int enabled);
+
+// Marks the start of a frame on the main thread.
+void profiler_frame(void);
+
+// Durations of the last count completed frames, oldest first, in ns.
+// Returns how many were filled.
+int profiler_frame_times(uint64_t *times, int count);
+
+// Per-stage totals over the last completed frame, returns the stage count.
+int profiler_stages(profile_stage_t *stages, int count);
+
+// Writes every buffered event as Chrome trace-event JSON, loadable in
+// chrome://tracing or Perfetto.
+int profiler_export(const char *path);
@@ -0,0 +1,493 @@
+#include <math.h>
+#include <stdatomic.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define RAYCAST_X86
+#endif
+
+#include "raycast.h"
+#include "utils.h"
+
+void dda_init(dda_t *dda, float pos_x, float pos_y, float dir_x, float dir_y) {
+    dda->map_x = (int)pos_x;
+    dda->map_y = (int)pos_y;
+    dda->step_x = (dir_x < 0) ? -1 : 1;
+    dda->step_y = (dir_y < 0) ? -1 : 1;
+    dda->count_x = 0;
+    dda->count_y = 0;
+
+    dda->delta_x = 1.0f / fmaxf(fabsf(dir_x), 0.000001f);
+    dda->delta_y = 1.0f / fmaxf(fabsf(dir_y), 0.000001f);
+    dda->base_x = ((dir_x < 0) ? pos_x - dda->map_x : dda->map_x + 1 - pos_x) * dda->delta_x;
+    dda->base_y = ((dir_y < 0) ? pos_y - dda->map_y : dda->map_y + 1 - pos_y) * dda->delta_y;
+
+    dda->distance = 0;
+    dda->side = 0;
+}
+
+void dda_step(dda_t *dda) {
+    float next_x = dda_next_x(dda);
+    float next_y = dda_next_y(dda);
+
+    if(next_x < next_y) {
+        dda->map_x += dda->step_x;
+        dda->count_x++;
+        dda->distance = next_x;
+        dda->side = 0;
+    }
+    else {
+        dda->map_y += dda->step_y;
+        dda->count_y++;
+        dda->distance = next_y;
+        dda->side = 1;
+    }
+}
+
+// Number of crossings n >= from, at lengths base + n * delta, that a single
+// stepping walk takes before reaching `limit`. Ties go to the y axis, as in
+// dda_step, hence `inclusive`.
+static int crossings_before(float base, float delta, int from, int max, float limit, int inclusive) {
+    float estimate = (limit - base) / delta;
+    int n = from;
+    if(estimate > from) n = estimate > max ? max : (int)estimate;
+
+    // the estimate is within a step or two, settle it with the exact values
+    while(n < max && (inclusive ? base + n * delta <= limit : base + n * delta < limit)) n++;
+    while(n > from && (inclusive ? base + (n - 1) * delta > limit : base + (n - 1) * delta >= limit)) n--;
+    return n;
+}
+
+void dda_skip(dda_t *dda, int shift) {
+    int mask = (1 << shift) - 1;
+    int left = dda->map_x & ~mask;
+    int top = dda->map_y & ~mask;
+
+    // crossings needed to leave the block along each axis
+    int out_x = (dda->step_x > 0) ? left + mask - dda->map_x + 1 : dda->map_x - left + 1;
+    int out_y = (dda->step_y > 0) ? top + mask - dda->map_y + 1 : dda->map_y - top + 1;
+
+    float exit_x = dda->base_x + (dda->count_x + out_x - 1) * dda->delta_x;
+    float exit_y = dda->base_y + (dda->count_y + out_y - 1) * dda->delta_y;
+
+    int count_x, count_y;
+    if(exit_x < exit_y) {
+        count_x = dda->count_x + out_x;
+        count_y = crossings_before(dda->base_y, dda->delta_y, dda->count_y, dda->count_y + out_y - 1, exit_x, 1);
+        dda->distance = exit_x;
+        dda->side = 0;
+    }
+    else {
+        count_y = dda->count_y + out_y;
+        count_x = crossings_before(dda->base_x, dda->delta_x, dda->count_x, dda->count_x + out_x - 1, exit_y, 0);
+        dda->distance = exit_y;
+        dda->side = 1;
+    }
+
+    dda->map_x += (count_x - dda->count_x) * dda->step_x;
+    dda->map_y += (count_y - dda->count_y) * dda->step_y;
+    dda->count_x = count_x;
+    dda->count_y = count_y;
+}
+
+// Whether the aligned block of 2^shift cells around the current cell lies
+// inside the map. Blocks start at 0, so only the far edges can cut one.
+static int block_in_map(const dda_t *dda, const map_t *map, int shift) {
+    int mask = (1 << shift) - 1;
+    return (dda->map_x | mask) < map->width && (dda->map_y | mask) < map->height;
+}
+
+// Empty tiles are left in one jump, and if the region above them is empty
+// as well the jump covers the whole region. A block cut by the map edge is
+// crossed a level down, down to single steps, since a jump out of it would
+// end past the first cell outside the map, where a miss must stop.
+static void skip_empty(dda_t *dda, const map_t *map) {
+    uint64_t region = map->regions[map_region(map, dda->map_x, dda->map_y)];
+    if(!region && block_in_map(dda, map, MAP_REGION_SHIFT)) dda_skip(dda, MAP_REGION_SHIFT);
+    else if(block_in_map(dda, map, MAP_TILE_SHIFT)) dda_skip(dda, MAP_TILE_SHIFT);
+    else dda_step(dda);
+}
+
+static void finish_hit(ray_hit_t *hit, const dda_t *dda, int wall_type, float pos_x, float pos_y, float dir_x, float dir_y) {
+    // position of the hit along the wall, mirrored so textures read left
+    // to right on every face
+    float wall_u;
+    if(dda->side == 0) wall_u = pos_y + dda->distance * dir_y - dda->map_y;
+    else wall_u = pos_x + dda->distance * dir_x - dda->map_x;
+    if(dda->side == 0 && dir_x < 0) wall_u = 1.0f - wall_u;
+    if(dda->side == 1 && dir_y > 0) wall_u = 1.0f - wall_u;
+
+    hit->distance = dda->distance * BLOCKS_WIDTH;
+    hit->dir_x = dir_x;
+    hit->dir_y = dir_y;
+    hit->wall_u = wall_u;
+    hit->map_x = dda->map_x;
+    hit->map_y = dda->map_y;
+    hit->side = dda->side;
+    hit->wall_type = wall_type;
+}
+
+void cast_ray(ray_hit_t *hit, const map_t *map, float pos_x, float pos_y, float dir_x, float dir_y) {
+    dda_t dda;
+    dda_init(&dda, pos_x, pos_y, dir_x, dir_y);
+
+    int wall_type = 0;
+    dda_step(&dda);
+
+    while(map_in_bounds(map, dda.map_x, dda.map_y)) {
+        uint64_t word = map->occupancy[map_tile(map, dda.map_x, dda.map_y)];
+
+        if(word == 0) {
+            skip_empty(&dda, map);
+            continue;
+        }
+
+        int bit = (dda.map_y & MAP_TILE_MASK) << MAP_TILE_SHIFT | (dda.map_x & MAP_TILE_MASK);
+        if((word >> bit) & 1) {
+            wall_type = map_get_wall(map, dda.map_x, dda.map_y);
+            break;
+        }
+        dda_step(&dda);
+    }
+
+    finish_hit(hit, &dda, wall_type, pos_x, pos_y, dir_x, dir_y);
+}
+
+int cast_ray_to_face(ray_hit_t *hit, const ray_hit_t *face, float pos_x, float pos_y, float dir_x, float dir_y) {
+    dda_t dda;
+    dda_init(&dda, pos_x, pos_y, dir_x, dir_y);
+    int count_x = (face->map_x - dda.map_x) * dda.step_x;
+    int count_y = (face->map_y - dda.map_y) * dda.step_y;
+    if(count_x < 0 || count_y < 0) return 0;
+
+    // The walk takes crossings in order of length, ties to the y axis, so
+    // it enters the face's cell through the face exactly when the other
+    // axis' crossings fall around the one onto the face like this.
+    if(face->side == 0) {
+        if(count_x == 0) return 0;
+        dda.count_x = count_x - 1;
+        dda.count_y = count_y;
+        dda.distance = dda_next_x(&dda);
+        if(count_y > 0 && dda.base_y + (count_y - 1) * dda.delta_y > dda.distance) return 0;
+        if(dda_next_y(&dda) <= dda.distance) return 0;
+    }
+    else {
+        if(count_y == 0) return 0;
+        dda.count_x = count_x;
+        dda.count_y = count_y - 1;
+        dda.distance = dda_next_y(&dda);
+        if(count_x > 0 && dda.base_x + (count_x - 1) * dda.delta_x >= dda.distance) return 0;
+        if(dda_next_x(&dda) < dda.distance) return 0;
+    }
+
+    dda.map_x = face->map_x;
+    dda.map_y = face->map_y;
+    dda.side = face->side;
+    finish_hit(hit, &dda, face->wall_type, pos_x, pos_y, dir_x, dir_y);
+    return 1;
+}
+
+#ifdef RAYCAST_X86
+
+// Packet state, one array entry per lane. The SIMD code keeps it in
+// registers while stepping and spills it here for the map probes.
+typedef struct {
+    _Alignas(32) int map_x[8];
+    _Alignas(32) int map_y[8];
+    _Alignas(32) int count_x[8];
+    _Alignas(32) int count_y[8];
+    _Alignas(32) float distance[8];
+    _Alignas(32) int side[8];
+    int wall_type[8];
+    dda_t dda[8];       // per-lane setup, for the scalar skips
+} lanes_t;
+
+static void lane_load(dda_t *dda, const lanes_t *lanes, int i) {
+    dda->map_x = lanes->map_x[i];
+    dda->map_y = lanes->map_y[i];
+    dda->count_x = lanes->count_x[i];
+    dda->count_y = lanes->count_y[i];
+    dda->distance = lanes->distance[i];
+    dda->side = lanes->side[i];
+}
+
+static void lane_store(lanes_t *lanes, const dda_t *dda, int i) {
+    lanes->map_x[i] = dda->map_x;
+    lanes->map_y[i] = dda->map_y;
+    lanes->count_x[i] = dda->count_x;
+    lanes->count_y[i] = dda->count_y;
+    lanes->distance[i] = dda->distance;
+    lanes->side[i] = dda->side;
+}
+
+// Probes the cell of every active lane, in the same order cast_ray does:
+// lanes that left the map or hit a wall are retired, lanes in empty tiles
+// skip until they reach an occupied tile. Returns the lanes that need a
+// regular step next and sets *skipped when any lane state was rewritten.
+//
+// The probes are plain loads: the occupancy lookup sits on the critical
+// path of every step, and hardware gathers were slower than four to eight
+// independent scalar loads there.
+static int probe_lanes(lanes_t *lanes, int *active, int *skipped, const map_t *map, int count) {
+    int stepping = 0;
+    *skipped = 0;
+
+    for(int i = 0; i < count; i++) {
+        if(!(*active & (1 << i))) continue;
+
+        int x = lanes->map_x[i];
+        int y = lanes->map_y[i];
+        uint64_t word = 0;
+        if(map_in_bounds(map, x, y)) word = map->occupancy[map_tile(map, x, y)];
+
+        if(word == 0 && map_in_bounds(map, x, y)) {
+            dda_t dda = lanes->dda[i];
+            lane_load(&dda, lanes, i);
+            do {
+                skip_empty(&dda, map);
+            } while(map_in_bounds(map, dda.map_x, dda.map_y) && map->occupancy[map_tile(map, dda.map_x, dda.map_y)] == 0);
+            lane_store(lanes, &dda, i);
+            *skipped = 1;
+
+            x = dda.map_x;
+            y = dda.map_y;
+            if(map_in_bounds(map, x, y)) word = map->occupancy[map_tile(map, x, y)];
+        }
+
+        if(!map_in_bounds(map, x, y)) {
+            *active &= ~(1 << i);
+            continue;
+        }
+
+        int bit = (y & MAP_TILE_MASK) << MAP_TILE_SHIFT | (x & MAP_TILE_MASK);
+        if((word >> bit) & 1) {
+            lanes->wall_type[i] = map_get_wall(map, x, y);
+            *active &= ~(1 << i);
+        }
+        else stepping |= 1 << i;
+    }
+    return stepping;
+}
+
+static void packet_init(lanes_t *lanes, int count, float pos_x, float pos_y, const float *dir_x, const float *dir_y) {
+    for(int i = 0; i < count; i++) {
+        dda_init(&lanes->dda[i], pos_x, pos_y, dir_x[i], dir_y[i]);
+        lanes->wall_type[i] = 0;
+    }
+}
+
+static void packet_finish(ray_hit_t *hits, int count, lanes_t *lanes, float pos_x, float pos_y, const float *dir_x, const float *dir_y) {
+    for(int i = 0; i < count; i++) {
+        dda_t dda;
+        lane_load(&dda, lanes, i);
+        finish_hit(&hits[i], &dda, lanes->wall_type[i], pos_x, pos_y, dir_x[i], dir_y[i]);
+    }
+}
+
+__attribute__((target("avx2")))
+static void cast_packet_avx2(ray_hit_t *hits, const map_t *map, float pos_x, float pos_y, const float *dir_x, const float *dir_y) {
+    lanes_t lanes;
+    packet_init(&lanes, 8, pos_x, pos_y, dir_x, dir_y);
+    // every ray of a packet starts in the same cell
+    int cell_x = (int)pos_x;
+    int cell_y = (int)pos_y;
+
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i lane_bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+
+    __m256 rd_x = _mm256_loadu_ps(dir_x);
+    __m256 rd_y = _mm256_loadu_ps(dir_y);
+    __m256 neg_x = _mm256_cmp_ps(rd_x, zero, _CMP_LT_OQ);
+    __m256 neg_y = _mm256_cmp_ps(rd_y, zero, _CMP_LT_OQ);
+
+    // same expressions as dda_init, lane by lane
+    __m256i step_x = _mm256_or_si256(_mm256_castps_si256(neg_x), one);
+    __m256i step_y = _mm256_or_si256(_mm256_castps_si256(neg_y), one);
+    __m256 sign = _mm256_set1_ps(-0.0f);
+    __m256 min_dir = _mm256_set1_ps(0.000001f);
+    __m256 delta_x = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_max_ps(_mm256_andnot_ps(sign, rd_x), min_dir));
+    __m256 delta_y = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_max_ps(_mm256_andnot_ps(sign, rd_y), min_dir));
+    __m256 base_x = _mm256_mul_ps(_mm256_blendv_ps(
+        _mm256_set1_ps(cell_x + 1 - pos_x), _mm256_set1_ps(pos_x - cell_x), neg_x), delta_x);
+    __m256 base_y = _mm256_mul_ps(_mm256_blendv_ps(
+        _mm256_set1_ps(cell_y + 1 - pos_y), _mm256_set1_ps(pos_y - cell_y), neg_y), delta_y);
+
+    __m256i map_x = _mm256_set1_epi32(cell_x);
+    __m256i map_y = _mm256_set1_epi32(cell_y);
+    __m256i count_x = _mm256_setzero_si256();
+    __m256i count_y = _mm256_setzero_si256();
+    __m256 distance = zero;
+    __m256i side = _mm256_setzero_si256();
+
+    int active = 0xff;
+    int stepping = 0xff;
+
+    while(1) {
+        // masked dda_step
+        __m256i step_mask = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(stepping), lane_bits), lane_bits);
+        __m256 next_x = _mm256_add_ps(base_x, _mm256_mul_ps(_mm256_cvtepi32_ps(count_x), delta_x));
+        __m256 next_y = _mm256_add_ps(base_y, _mm256_mul_ps(_mm256_cvtepi32_ps(count_y), delta_y));
+        __m256i take_x = _mm256_castps_si256(_mm256_cmp_ps(next_x, next_y, _CMP_LT_OQ));
+        __m256i move_x = _mm256_and_si256(take_x, step_mask);
+        __m256i move_y = _mm256_andnot_si256(take_x, step_mask);
+
+        map_x = _mm256_add_epi32(map_x, _mm256_and_si256(step_x, move_x));
+        map_y = _mm256_add_epi32(map_y, _mm256_and_si256(step_y, move_y));
+        count_x = _mm256_sub_epi32(count_x, move_x);
+        count_y = _mm256_sub_epi32(count_y, move_y);
+        distance = _mm256_blendv_ps(distance, _mm256_blendv_ps(next_y, next_x, _mm256_castsi256_ps(take_x)),
+            _mm256_castsi256_ps(step_mask));
+        side = _mm256_blendv_epi8(side, _mm256_andnot_si256(take_x, one), step_mask);
+
+        _mm256_store_si256((__m256i *)lanes.map_x, map_x);
+        _mm256_store_si256((__m256i *)lanes.map_y, map_y);
+        _mm256_store_si256((__m256i *)lanes.count_x, count_x);
+        _mm256_store_si256((__m256i *)lanes.count_y, count_y);
+        _mm256_store_ps(lanes.distance, distance);
+        _mm256_store_si256((__m256i *)lanes.side, side);
+
+        // the probes are SSE code, leave no dirty upper halves for them
+        _mm256_zeroupper();
+        int skipped;
+        stepping = probe_lanes(&lanes, &active, &skipped, map, 8);
+        if(!active) break;
+
+        if(skipped) {
+            map_x = _mm256_load_si256((const __m256i *)lanes.map_x);
+            map_y = _mm256_load_si256((const __m256i *)lanes.map_y);
+            count_x = _mm256_load_si256((const __m256i *)lanes.count_x);
+            count_y = _mm256_load_si256((const __m256i *)lanes.count_y);
+            distance = _mm256_load_ps(lanes.distance);
+            side = _mm256_load_si256((const __m256i *)lanes.side);
+        }
+    }
+
+    _mm256_zeroupper();
+    packet_finish(hits, 8, &lanes, pos_x, pos_y, dir_x, dir_y);
+}
+
+static void cast_packet_sse2(ray_hit_t *hits, const map_t *map, float pos_x, float pos_y, const float *dir_x, const float *dir_y) {
+    lanes_t lanes;
+    packet_init(&lanes, 4, pos_x, pos_y, dir_x, dir_y);
+    int cell_x = (int)pos_x;
+    int cell_y = (int)pos_y;
+
+    const __m128 zero = _mm_setzero_ps();
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i lane_bits = _mm_setr_epi32(1, 2, 4, 8);
+
+    __m128 rd_x = _mm_loadu_ps(dir_x);
+    __m128 rd_y = _mm_loadu_ps(dir_y);
+    __m128 neg_x = _mm_cmplt_ps(rd_x, zero);
+    __m128 neg_y = _mm_cmplt_ps(rd_y, zero);
+
+    __m128i step_x = _mm_or_si128(_mm_castps_si128(neg_x), one);
+    __m128i step_y = _mm_or_si128(_mm_castps_si128(neg_y), one);
+    __m128 sign = _mm_set1_ps(-0.0f);
+    __m128 min_dir = _mm_set1_ps(0.000001f);
+    __m128 delta_x = _mm_div_ps(_mm_set1_ps(1.0f), _mm_max_ps(_mm_andnot_ps(sign, rd_x), min_dir));
+    __m128 delta_y = _mm_div_ps(_mm_set1_ps(1.0f), _mm_max_ps(_mm_andnot_ps(sign, rd_y), min_dir));
+    __m128 base_x = _mm_mul_ps(_mm_or_ps(_mm_and_ps(neg_x, _mm_set1_ps(pos_x - cell_x)),
+        _mm_andnot_ps(neg_x, _mm_set1_ps(cell_x + 1 - pos_x))), delta_x);
+    __m128 base_y = _mm_mul_ps(_mm_or_ps(_mm_and_ps(neg_y, _mm_set1_ps(pos_y - cell_y)),
+        _mm_andnot_ps(neg_y, _mm_set1_ps(cell_y + 1 - pos_y))), delta_y);
+
+    __m128i map_x = _mm_set1_epi32(cell_x);
+    __m128i map_y = _mm_set1_epi32(cell_y);
+    __m128i count_x = _mm_setzero_si128();
+    __m128i count_y = _mm_setzero_si128();
+    __m128 distance = zero;
+    __m128i side = _mm_setzero_si128();
+
+    int active = 0xf;
+    int stepping = 0xf;
+
+    while(1) {
+        // SSE2 has no blendv, select with and/andnot/or
+        __m128i step_mask = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(stepping), lane_bits), lane_bits);
+        __m128 next_x = _mm_add_ps(base_x, _mm_mul_ps(_mm_cvtepi32_ps(count_x), delta_x));
+        __m128 next_y = _mm_add_ps(base_y, _mm_mul_ps(_mm_cvtepi32_ps(count_y), delta_y));
+        __m128i take_x = _mm_castps_si128(_mm_cmplt_ps(next_x, next_y));
+        __m128i move_x = _mm_and_si128(take_x, step_mask);
+        __m128i move_y = _mm_andnot_si128(take_x, step_mask);
+        __m128 step_ps = _mm_castsi128_ps(step_mask);
+        __m128 take_ps = _mm_castsi128_ps(take_x);
+
+        map_x = _mm_add_epi32(map_x, _mm_and_si128(step_x, move_x));
+        map_y = _mm_add_epi32(map_y, _mm_and_si128(step_y, move_y));
+        count_x = _mm_sub_epi32(count_x, move_x);
+        count_y = _mm_sub_epi32(count_y, move_y);
+        __m128 next = _mm_or_ps(_mm_and_ps(take_ps, next_x), _mm_andnot_ps(take_ps, next_y));
+        distance = _mm_or_ps(_mm_and_ps(step_ps, next), _mm_andnot_ps(step_ps, distance));
+        side = _mm_or_si128(_mm_and_si128(step_mask, _mm_andnot_si128(take_x, one)), _mm_andnot_si128(step_mask, side));
+
+        _mm_store_si128((__m128i *)lanes.map_x, map_x);
+        _mm_store_si128((__m128i *)lanes.map_y, map_y);
+        _mm_store_si128((__m128i *)lanes.count_x, count_x);
+        _mm_store_si128((__m128i *)lanes.count_y, count_y);
+        _mm_store_ps(lanes.distance, distance);
+        _mm_store_si128((__m128i *)lanes.side, side);
+
+        int skipped;
+        stepping = probe_lanes(&lanes, &active, &skipped, map, 4);
+        if(!active) break;
+
+        if(skipped) {
+            map_x = _mm_load_si128((const __m128i *)lanes.map_x);
+            map_y = _mm_load_si128((const __m128i *)lanes.map_y);
+            count_x = _mm_load_si128((const __m128i *)lanes.count_x);
+            count_y = _mm_load_si128((const __m128i *)lanes.count_y);
+            distance = _mm_load_ps(lanes.distance);
+            side = _mm_load_si128((const __m128i *)lanes.side);
+        }
+    }
+
+    packet_finish(hits, 4, &lanes, pos_x, pos_y, dir_x, dir_y);
+}
+
+#endif
+
+// Atomic because render workers may resolve the level lazily at the same
+// time; they all store the same value.
+static atomic_int simd_level = -1;
+
+int raycast_simd_level(void) {
+    int level = atomic_load_explicit(&simd_level, memory_order_relaxed);
+    if(level >= 0) return level;
+    raycast_set_simd_level(SIMD_AVX2);
+    return atomic_load_explicit(&simd_level, memory_order_relaxed);
+}
+
+void raycast_set_simd_level(int level) {
+    int supported = SIMD_NONE;
+#ifdef RAYCAST_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) supported = SIMD_AVX2;
+    else if(__builtin_cpu_supports("sse2")) supported = SIMD_SSE2;
+#endif
+    atomic_store_explicit(&simd_level, level < supported ? level : supported, memory_order_relaxed);
+}
+
+int raycast_packet_lanes(void) {
+    switch(raycast_simd_level()) {
+        case SIMD_AVX2: return 8;
+        case SIMD_SSE2: return 4;
+        default: return 1;
+    }
+}
+
+void cast_ray_packet(ray_hit_t *hits, const map_t *map, float pos_x, float pos_y, const float *dir_x, const float *dir_y) {
+    switch(raycast_simd_level()) {
+#ifdef RAYCAST_X86
+        case SIMD_AVX2:
+            cast_packet_avx2(hits, map, pos_x, pos_y, dir_x, dir_y);
+            return;
+        case SIMD_SSE2:
+            cast_packet_sse2(hits, map, pos_x, pos_y, dir_x, dir_y);
+            return;
+#endif
+        default:
+            cast_ray(hits, map, pos_x, pos_y, dir_x[0], dir_y[0]);
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "map.h"
+
+// Result of casting the ray for one framebuffer column.
+typedef struct {
+    float distance;     // ray parameter at the hit in world units; for a
+                        // camera-plane ray this is the perpendicular distance
+    float dir_x;        // ray direction as cast, not normalised
+    float dir_y;
+    float wall_u;       // hit position across the wall face, 0..1
+    int map_x;
+    int map_y;
+    int side;           // 0 = hit a vertical grid line, 1 = horizontal
+    int wall_type;      // 0 when the ray left the map without a hit
+} ray_hit_t;
+
+// DDA state. The ray length to the n-th crossing of a vertical grid line
+// is always computed as base_x + n * delta_x rather than accumulated, so
+// jumping over many cells lands on exactly the values single steps would.
+typedef struct {
+    int map_x;
+    int map_y;
+    int step_x;
+    int step_y;
+    int count_x;        // vertical grid lines crossed so far
+    int count_y;
+    float base_x;
+    float base_y;
+    float delta_x;
+    float delta_y;
+    float distance;     // ray length at the last crossing, cell units
+    int side;
+} dda_t;
+
+static inline float dda_next_x(const dda_t *dda) {
+    return dda->base_x + dda->count_x * dda->delta_x;
+}
+
+static inline float dda_next_y(const dda_t *dda) {
+    return dda->base_y + dda->count_y * dda->delta_y;
+}
+
+// pos in cell units; dir need not be normalised, distances come out in
+// multiples of its length
+void dda_init(dda_t *dda, float pos_x, float pos_y, float dir_x, float dir_y);
+void dda_step(dda_t *dda);
+
+// Leaves the aligned block of 2^shift cells containing the current cell,
+// ending on the same cell, side and distance that single steps would.
+void dda_skip(dda_t *dda, int shift);
+
+// Walks the map from (pos_x, pos_y) in cell units along (dir_x, dir_y).
+// Empty tiles and regions are crossed in one jump, so the
+// cost depends on the number of occupied tiles passed, not on distance.
+void cast_ray(ray_hit_t *hit, const map_t *map, float pos_x, float pos_y, float dir_x, float dir_y);
+
+// The hit cast_ray returns when its walk ends on the wall face of `face`,
+// found without walking: the same arithmetic gives the same bits. Fails
+// when the walk would enter the face's cell through another side, as it
+// can near the face's corners. Whether anything blocks the way first is
+// up to the caller.
+int cast_ray_to_face(ray_hit_t *hit, const ray_hit_t *face, float pos_x, float pos_y, float dir_x, float dir_y);
+
+// SIMD packet path: adjacent rays walk the grid in lock-step, with masked
+// stepping and batched map probes. Results are bit-identical to calling
+// cast_ray for each ray; make test checks this on random poses.
+enum { SIMD_NONE, SIMD_SSE2, SIMD_AVX2 };
+
+// Highest level the CPU supports unless lowered with raycast_set_simd_level.
+int raycast_simd_level(void);
+void raycast_set_simd_level(int level);
+
+// Rays per packet for the current level, 1 without SIMD.
+int raycast_packet_lanes(void);
+
+// Casts raycast_packet_lanes() rays from the same origin.
+void cast_ray_packet(ray_hit_t *hits, const map_t *map, float pos_x, float pos_y, const float *dir_x, const float *dir_y);
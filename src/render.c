@@ -0,0 +1,796 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define RENDER_X86
+#endif
+
+#include "profiler.h"
+#include "render.h"
+#include "utils.h"
+
+#define CEILING_COLOR RGB(20, 50, 90)
+#define FLOOR_COLOR RGB(0, 0, 0)
+#define FLOOR_ONE 4294967296.0f
+
+// Column and row steps per quality level, finest first.
+static const struct { int column_step, row_step; } quality_levels[RENDER_QUALITY_LEVELS] = {
+    { 1, 1 }, { 1, 2 }, { 2, 2 }, { 3, 2 }, { 4, 2 },
+};
+
+int renderer_init(renderer_t *r, const atlas_t *atlas, int width, int height, int threads) {
+    r->atlas = atlas;
+    if(framebuffer_init(&r->fb, width, height) < 0) return -1;
+
+    // current and previous frame's hits in one block
+    size_t columns = (width + TILE_COLUMNS - 1) / TILE_COLUMNS * TILE_COLUMNS;
+    r->hits = aligned_alloc(64, 2 * columns * sizeof(ray_hit_t));
+    if(!r->hits) {
+        printf("Failed to allocate ray buffer\n");
+        framebuffer_free(&r->fb);
+        return -1;
+    }
+    r->previous_hits = r->hits + columns;
+
+    r->camera_x = malloc(2 * width * sizeof(float));
+    if(!r->camera_x) {
+        printf("Failed to allocate camera table\n");
+        free(r->hits);
+        framebuffer_free(&r->fb);
+        return -1;
+    }
+    r->camera_angle = r->camera_x + width;
+
+    // one block too, each table padded to whole tiles so the columns of
+    // one tile never share a cache line with another tile's
+    r->wall_top = aligned_alloc(64, 4 * columns * sizeof(int));
+    if(!r->wall_top) {
+        printf("Failed to allocate column tables\n");
+        free(r->camera_x);
+        free(r->hits);
+        framebuffer_free(&r->fb);
+        return -1;
+    }
+    r->wall_bottom = r->wall_top + columns;
+    r->column_run = r->wall_top + 2 * columns;
+    r->hit_known = r->wall_top + 3 * columns;
+
+    r->pool = threadpool_create(threads);
+    if(!r->pool) {
+        free(r->wall_top);
+        free(r->camera_x);
+        free(r->hits);
+        framebuffer_free(&r->fb);
+        return -1;
+    }
+    r->sprite_views = NULL;
+    r->sprite_keys = NULL;
+    r->sprite_order = NULL;
+    r->sprite_scratch = NULL;
+    r->sprite_capacity = 0;
+    r->sprite_count = 0;
+    r->fov = 60 * (M_PI / 180);
+    r->camera_fov = 0;
+    r->budget_ms = 0;
+    r->frame_ms = 0;
+    r->settle = 0;
+    r->cache = 1;
+    r->cache_valid = 0;
+    r->reused_columns = 0;
+    r->unchanged = 0;
+    atomic_init(&r->cast_rays, 0);
+    renderer_set_quality(r, 0);
+    return 0;
+}
+
+void renderer_set_quality(renderer_t *r, int quality) {
+    if(quality < 0) quality = 0;
+    if(quality > RENDER_QUALITY_LEVELS - 1) quality = RENDER_QUALITY_LEVELS - 1;
+    r->quality = quality;
+    r->column_step = quality_levels[quality].column_step;
+    r->row_step = quality_levels[quality].row_step;
+}
+
+void renderer_adapt(renderer_t *r, double frame_ms) {
+    if(r->budget_ms <= 0) return;
+
+    r->frame_ms = r->frame_ms > 0 ? r->frame_ms + (frame_ms - r->frame_ms) * RENDER_EMA : frame_ms;
+    if(++r->settle < RENDER_SETTLE) return;
+
+    // the gap between the thresholds keeps it from flipping every settle
+    if(r->frame_ms > r->budget_ms && r->quality < RENDER_QUALITY_LEVELS - 1) {
+        renderer_set_quality(r, r->quality + 1);
+        r->settle = 0;
+    }
+    else if(r->frame_ms < r->budget_ms * 0.6f && r->quality > 0) {
+        renderer_set_quality(r, r->quality - 1);
+        r->settle = 0;
+    }
+}
+
+// Column centres spread evenly over [-1, 1] across the camera plane.
+static void update_camera(renderer_t *r) {
+    if(r->camera_fov == r->fov) return;
+
+    r->plane_scale = tan(r->fov / 2);
+    for(int i = 0; i < r->fb.width; i++) {
+        r->camera_x[i] = (2 * i + 1) / (float)r->fb.width - 1;
+        r->camera_angle[i] = atanf(r->camera_x[i] * r->plane_scale);
+    }
+    r->camera_fov = r->fov;
+}
+
+void renderer_free(renderer_t *r) {
+    framebuffer_free(&r->fb);
+    free(r->hits);
+    r->hits = NULL;
+    r->previous_hits = NULL;
+    free(r->camera_x);
+    r->camera_x = NULL;
+    r->camera_angle = NULL;
+    free(r->wall_top);
+    r->wall_top = NULL;
+    r->wall_bottom = NULL;
+    r->column_run = NULL;
+    r->hit_known = NULL;
+    free(r->sprite_views);
+    free(r->sprite_keys);
+    free(r->sprite_order);
+    free(r->sprite_scratch);
+    r->sprite_views = NULL;
+    r->sprite_keys = NULL;
+    r->sprite_order = NULL;
+    r->sprite_scratch = NULL;
+    r->sprite_capacity = 0;
+    threadpool_destroy(r->pool);
+    r->pool = NULL;
+}
+
+// Per-column wall span and texture lookup, shared by the scalar and SIMD
+// column writers so both produce the same pixels.
+typedef struct {
+    int line_start;     // first wall row, may lie above the framebuffer
+    int line_end;
+    uint32_t tex_step;  // 16.16 fixed point texture rows per screen row
+    uint32_t texel;     // first texel of the texture column in the atlas
+    int row_shift;      // log2 of the mip level width
+    int row_mask;       // mip level height - 1
+    uint32_t shade;     // 8.8 fixed point, 256 leaves the texel unchanged
+} column_t;
+
+#define SHADE_LIT 256
+#define SHADE_DARK 179
+
+static void column_setup(column_t *col, const atlas_t *atlas, int height, const ray_hit_t *hit) {
+    if(hit->wall_type == 0) {
+        col->line_start = height / 2;
+        col->line_end = height / 2;
+        col->tex_step = 0;
+        col->texel = 0;
+        col->row_shift = 0;
+        col->row_mask = 0;
+        col->shade = SHADE_LIT;
+        return;
+    }
+
+    float line = height / hit->distance * 25;
+    int line_height = (line > height * 3) ? height * 3 : (int)line;
+    if(line_height < 1) line_height = 1;
+    col->line_start = (height - line_height) / 2;
+    col->line_end = col->line_start + line_height;
+
+    // distant walls read a small level, which keeps the fetches in cache
+    const texture_t *tex = atlas_texture(atlas, hit->wall_type);
+    int level = atlas_level(tex, line_height);
+    int width = tex->width >> level;
+    int tex_height = tex->height >> level;
+    col->tex_step = ((uint32_t)tex_height << 16) / line_height;
+
+    int texture_x = (int)(hit->wall_u * width);
+    if(texture_x < 0) texture_x = 0;
+    if(texture_x > width - 1) texture_x = width - 1;
+    col->texel = tex->offset[level] + texture_x;
+    col->row_shift = tex->width_shift - level;
+    col->row_mask = tex_height - 1;
+    col->shade = (hit->side == 0) ? SHADE_LIT : SHADE_DARK;
+}
+
+// Scales red and blue in one multiply and green in another; alpha is forced
+// opaque since walls never show through.
+static inline uint32_t shade_texel(uint32_t texel, uint32_t shade) {
+    uint32_t rb = ((texel & 0x00ff00ff) * shade >> 8) & 0x00ff00ff;
+    uint32_t g = ((texel & 0x0000ff00) * shade >> 8) & 0x0000ff00;
+    return rb | g | 0xff000000;
+}
+
+// Writes each pixel to run adjacent columns, the ones repeating column x.
+static inline void fill_run(uint32_t *pixel, int run, uint32_t color) {
+    if(run == 1) *pixel = color;
+    else for(int i = 0; i < run; i++) pixel[i] = color;
+}
+
+// Rows are taken in aligned groups of row_step, each filled with the texel
+// of its first wall row, so coarser levels fetch and shade fewer texels.
+static void draw_column(framebuffer_t *fb, const uint32_t *texels, int x, int run, int row_step, const column_t *col) {
+    uint32_t *pixel = fb->pixels + x;
+    int stride = fb->stride;
+
+    int y = col->line_start < 0 ? 0 : col->line_start;
+    int wall_end = col->line_end > fb->height ? fb->height : col->line_end;
+
+    const uint32_t *column = texels + col->texel;
+    if(row_step == 1) {
+        // no division inside the loop, the texture row advances in fixed point
+        uint32_t tex_pos = (y - col->line_start) * col->tex_step;
+        for(; y < wall_end; y++) {
+            int texture_y = (tex_pos >> 16) & col->row_mask;
+            tex_pos += col->tex_step;
+            fill_run(pixel + y * stride, run, shade_texel(column[texture_y << col->row_shift], col->shade));
+        }
+        return;
+    }
+
+    while(y < wall_end) {
+        int texture_y = (((uint32_t)(y - col->line_start) * col->tex_step) >> 16) & col->row_mask;
+        uint32_t color = shade_texel(column[texture_y << col->row_shift], col->shade);
+        int group_end = (y / row_step + 1) * row_step;
+        if(group_end > wall_end) group_end = wall_end;
+        for(; y < group_end; y++) fill_run(pixel + y * stride, run, color);
+    }
+}
+
+#ifdef RENDER_X86
+// Eight adjacent columns at once, one group of row_step framebuffer rows
+// at a time: each lane fetches its RGBA8 texel with a single gather, at
+// the same row draw_column samples, and every row is written as one masked
+// 32-byte store instead of up to eight strided ones.
+__attribute__((target("avx2")))
+static void draw_packet_avx2(framebuffer_t *fb, const uint32_t *texels, int x, int row_step, const column_t *cols) {
+    _Alignas(32) int start[8], end[8], step[8], texel[8], shift[8], mask[8], shade[8];
+    int min_start = fb->height;
+    int max_end = 0;
+    for(int i = 0; i < 8; i++) {
+        start[i] = cols[i].line_start;
+        end[i] = cols[i].line_end;
+        step[i] = cols[i].tex_step;
+        texel[i] = cols[i].texel;
+        shift[i] = cols[i].row_shift;
+        mask[i] = cols[i].row_mask;
+        shade[i] = cols[i].shade;
+        if(start[i] < min_start) min_start = start[i];
+        if(end[i] > max_end) max_end = end[i];
+    }
+
+    __m256i line_start = _mm256_load_si256((const __m256i *)start);
+    __m256i line_end = _mm256_load_si256((const __m256i *)end);
+    __m256i tex_step = _mm256_load_si256((const __m256i *)step);
+    __m256i tex_column = _mm256_load_si256((const __m256i *)texel);
+    __m256i row_shift = _mm256_load_si256((const __m256i *)shift);
+    __m256i row_mask = _mm256_load_si256((const __m256i *)mask);
+    __m256i tex_shade = _mm256_load_si256((const __m256i *)shade);
+
+    const __m256i alpha = _mm256_set1_epi32(0xff000000u);
+    const __m256i rb_mask = _mm256_set1_epi32(0x00ff00ff);
+    const __m256i g_mask = _mm256_set1_epi32(0x0000ff00);
+    const __m256i one = _mm256_set1_epi32(1);
+
+    if(min_start < 0) min_start = 0;
+    if(max_end > fb->height) max_end = fb->height;
+
+    for(int y = min_start; y < max_end;) {
+        int group_end = (y / row_step + 1) * row_step;
+        if(group_end > max_end) group_end = max_end;
+
+        // lanes with wall anywhere in the group sample its first wall row
+        __m256i first = _mm256_set1_epi32(y);
+        __m256i above = _mm256_cmpgt_epi32(line_start, _mm256_set1_epi32(group_end - 1));
+        __m256i below = _mm256_cmpgt_epi32(_mm256_add_epi32(first, one), line_end);
+        __m256i any = _mm256_andnot_si256(_mm256_or_si256(above, below), _mm256_set1_epi32(-1));
+
+        __m256i sample_y = _mm256_max_epi32(first, line_start);
+        __m256i tex_pos = _mm256_mullo_epi32(_mm256_sub_epi32(sample_y, line_start), tex_step);
+        __m256i texture_y = _mm256_and_si256(_mm256_srli_epi32(tex_pos, 16), row_mask);
+        __m256i index = _mm256_add_epi32(tex_column, _mm256_sllv_epi32(texture_y, row_shift));
+
+        __m256i color = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), (const int *)texels, index, any, 4);
+        __m256i rb = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_and_si256(color, rb_mask), tex_shade), 8);
+        __m256i g = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_and_si256(color, g_mask), tex_shade), 8);
+        color = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(rb, rb_mask), _mm256_and_si256(g, g_mask)), alpha);
+
+        for(; y < group_end; y++) {
+            int *row = (int *)(fb->pixels + (size_t)y * fb->stride + x);
+            __m256i row_y = _mm256_set1_epi32(y);
+            __m256i wall = _mm256_andnot_si256(_mm256_or_si256(_mm256_cmpgt_epi32(line_start, row_y),
+                _mm256_cmpgt_epi32(_mm256_add_epi32(row_y, one), line_end)), _mm256_set1_epi32(-1));
+            _mm256_maskstore_epi32(row, wall, color);
+        }
+    }
+}
+#endif
+
+typedef struct {
+    renderer_t *r;
+    const player_t *player;
+    const map_t *map;
+    const sprites_t *sprites;
+    const int *known;   // columns already filled from the cache, or NULL
+} frame_job_t;
+
+// Casts the listed columns of one tile, in packets where it can, leaving
+// out any the cache has already filled.
+static void cast_columns(const frame_job_t *job, int tile, const int *listed, int listed_count) {
+    renderer_t *r = job->r;
+    float plane_x = -job->player->dir_y * r->plane_scale;
+    float plane_y = job->player->dir_x * r->plane_scale;
+    float pos_x = job->player->x / (float)BLOCKS_WIDTH;
+    float pos_y = job->player->y / (float)BLOCKS_HEIGHT;
+    int lanes = raycast_packet_lanes();
+
+    float dir_x[TILE_COLUMNS];
+    float dir_y[TILE_COLUMNS];
+    _Alignas(64) ray_hit_t found[TILE_COLUMNS];
+    int columns[TILE_COLUMNS];
+    int count = 0;
+    for(int i = 0; i < listed_count; i++) {
+        if(!job->known || !job->known[tile + listed[i]]) columns[count++] = listed[i];
+    }
+    for(int i = 0; i < count; i++) {
+        dir_x[i] = job->player->dir_x + plane_x * r->camera_x[tile + columns[i]];
+        dir_y[i] = job->player->dir_y + plane_y * r->camera_x[tile + columns[i]];
+    }
+
+    int i = 0;
+    for(; lanes > 1 && i + lanes <= count; i += lanes) {
+        cast_ray_packet(&found[i], job->map, pos_x, pos_y, &dir_x[i], &dir_y[i]);
+    }
+    for(; i < count; i++) {
+        cast_ray(&found[i], job->map, pos_x, pos_y, dir_x[i], dir_y[i]);
+    }
+
+    if(count > 0) atomic_fetch_add_explicit(&r->cast_rays, count, memory_order_relaxed);
+
+    // camera-plane rays already give the perpendicular distance
+    for(i = 0; i < count; i++) {
+        if(found[i].distance < 0.1f) found[i].distance = 0.1f;
+        r->hits[tile + columns[i]] = found[i];
+    }
+}
+
+static int same_face(const ray_hit_t *a, const ray_hit_t *b) {
+    return a->wall_type != 0 && a->wall_type == b->wall_type && a->side == b->side &&
+           a->map_x == b->map_x && a->map_y == b->map_y;
+}
+
+// Casts and draws one tile of columns. At column steps above one only
+// every step-th column and the tile's last are cast first; a gap between
+// two that hit the same wall face repeats the left one, and any other gap
+// holds an edge and is cast in full, so silhouettes keep full resolution.
+static void render_columns(void *ctx, int begin, int end, int worker) {
+    (void)worker;
+    frame_job_t *job = ctx;
+    renderer_t *r = job->r;
+    int step = r->column_step;
+    int packet_draw = raycast_simd_level() == SIMD_AVX2 && step == 1;
+
+    int columns[TILE_COLUMNS];
+    column_t cols[TILE_COLUMNS];
+
+    for(int tile = begin; tile < end; tile += TILE_COLUMNS) {
+        int count = (end - tile < TILE_COLUMNS) ? end - tile : TILE_COLUMNS;
+        ray_hit_t *hits = &r->hits[tile];
+        int *run = &r->column_run[tile];
+        int source[TILE_COLUMNS];
+
+        uint64_t cast_start = profile_begin();
+        int cast = 0;
+        for(int i = 0; i < count; i += step) columns[cast++] = i;
+        if(columns[cast - 1] != count - 1) columns[cast++] = count - 1;
+        cast_columns(job, tile, columns, cast);
+
+        int anchors = cast;
+        cast = 0;
+        for(int i = 0; i < anchors; i++) {
+            int left = columns[i];
+            source[left] = left;
+            if(i + 1 == anchors) break;
+
+            int right = columns[i + 1];
+            int reuse = same_face(&hits[left], &hits[right]);
+            for(int x = left + 1; x < right; x++) {
+                source[x] = reuse ? left : x;
+                if(reuse) hits[x] = hits[left];
+            }
+            // the edge columns go after the anchors, which stay in order
+            if(!reuse) for(int x = left + 1; x < right; x++) columns[anchors + cast++] = x;
+        }
+        if(cast > 0) cast_columns(job, tile, columns + anchors, cast);
+        profile_end("cast", cast_start);
+
+        uint64_t wall_start = profile_begin();
+        for(int i = 0; i < count; i++) {
+            run[i] = 0;
+            run[source[i]]++;
+            if(source[i] != i) {
+                r->wall_top[tile + i] = r->wall_top[tile + source[i]];
+                r->wall_bottom[tile + i] = r->wall_bottom[tile + source[i]];
+                continue;
+            }
+            column_setup(&cols[i], r->atlas, r->fb.height, &hits[i]);
+            r->wall_top[tile + i] = cols[i].line_start < 0 ? 0 : cols[i].line_start;
+            r->wall_bottom[tile + i] = cols[i].line_end > r->fb.height ? r->fb.height : cols[i].line_end;
+        }
+
+        int i = 0;
+#ifdef RENDER_X86
+        for(; packet_draw && i + 8 <= count; i += 8) draw_packet_avx2(&r->fb, r->atlas->texels, tile + i, r->row_step, &cols[i]);
+#else
+        (void)packet_draw;
+#endif
+        for(; i < count; i++) {
+            if(run[i] > 0) draw_column(&r->fb, r->atlas->texels, tile + i, run[i], r->row_step, &cols[i]);
+        }
+        profile_end("walls", wall_start);
+    }
+}
+
+// Floor and ceiling, one mirrored pair of rows per work item. Every pixel
+// of a row lies at the same distance, so the world position steps by a
+// constant per column and no division or trig runs per pixel. Cells with
+// floor type 0 keep the flat colours; others sample that texture on the
+// floor and a darker copy on the ceiling. Columns repeating a neighbour
+// are filled with its pixels, and at row steps above one only the first
+// row of each step is cast; the others copy it outside their wall spans.
+static void render_rows(void *ctx, int begin, int end, int worker) {
+    (void)worker;
+    frame_job_t *job = ctx;
+    renderer_t *r = job->r;
+    const map_t *map = job->map;
+    const atlas_t *atlas = r->atlas;
+    int width = r->fb.width;
+    int height = r->fb.height;
+
+    float plane_x = -job->player->dir_y * r->plane_scale;
+    float plane_y = job->player->dir_x * r->plane_scale;
+    float pos_x = job->player->x / (float)BLOCKS_WIDTH;
+    float pos_y = job->player->y / (float)BLOCKS_HEIGHT;
+    const int *run = r->column_run;
+    uint64_t start = profile_begin();
+
+    // row steps divide FLOOR_ROWS, so each step's first row is in this range
+    for(int row = begin; row < end; row++) {
+        int floor_y = height - 1 - row;
+        uint32_t *ceiling = r->fb.pixels + (size_t)row * r->fb.stride;
+        uint32_t *floor_row = r->fb.pixels + (size_t)floor_y * r->fb.stride;
+
+        int first = row - row % r->row_step;
+        if(first != row) {
+            const uint32_t *first_ceiling = r->fb.pixels + (size_t)first * r->fb.stride;
+            const uint32_t *first_floor = r->fb.pixels + (size_t)(height - 1 - first) * r->fb.stride;
+            for(int x = 0; x < width; x++) {
+                if(row < r->wall_top[x]) ceiling[x] = first_ceiling[x];
+                if(floor_y >= r->wall_bottom[x]) floor_row[x] = first_floor[x];
+            }
+            continue;
+        }
+
+        // rows above and below the horizon by p pixels see the floor where
+        // a wall at this distance would end: p = height * 25 / (2 * distance)
+        float p = height / 2.0f - row - 0.5f;
+        if(p <= 0) {
+            for(int x = 0; x < width; x++) {
+                if(row < r->wall_top[x] || row >= r->wall_bottom[x]) ceiling[x] = CEILING_COLOR;
+            }
+            continue;
+        }
+        float distance = height * 25 / (2 * p) / BLOCKS_WIDTH;
+
+        float step_x = distance * plane_x * 2 / width;
+        float step_y = distance * plane_y * 2 / width;
+        float start_x = pos_x + distance * (job->player->dir_x + plane_x * r->camera_x[0]);
+        float start_y = pos_y + distance * (job->player->dir_y + plane_y * r->camera_x[0]);
+
+        // texture footprint of one pixel in cells, picks the mip per type
+        float footprint = sqrtf(step_x * step_x + step_y * step_y);
+        int last_type = 0;
+        const texture_t *tex = NULL;
+        const uint32_t *texels = NULL;
+        int level_shift = 0, u_shift = 0, v_shift = 0;
+
+        // 32.32 fixed point cells, so the walk needs no float conversions
+        // and the texel falls out of the fraction bits
+        int64_t world_x = (int64_t)(start_x * FLOOR_ONE);
+        int64_t world_y = (int64_t)(start_y * FLOOR_ONE);
+        int64_t delta_x = (int64_t)(step_x * FLOOR_ONE);
+        int64_t delta_y = (int64_t)(step_y * FLOOR_ONE);
+
+        for(int x = 0; x < width; x++, world_x += delta_x, world_y += delta_y) {
+            if(run[x] == 0) continue;
+            int draw_ceiling = row < r->wall_top[x];
+            int draw_floor = floor_y >= r->wall_bottom[x];
+            if(!draw_ceiling && !draw_floor) continue;
+
+            int type = 0;
+            uint64_t cell_x = (uint64_t)world_x >> 32;
+            uint64_t cell_y = (uint64_t)world_y >> 32;
+            if(cell_x < (uint64_t)map->width && cell_y < (uint64_t)map->height) {
+                type = map->floors[map_index(map, cell_x, cell_y)];
+            }
+            if(type == 0) {
+                if(draw_ceiling) fill_run(ceiling + x, run[x], CEILING_COLOR);
+                if(draw_floor) fill_run(floor_row + x, run[x], FLOOR_COLOR);
+                continue;
+            }
+
+            if(type != last_type) {
+                tex = atlas_texture(atlas, type);
+                int level = 0;
+                while(level + 1 < tex->levels && footprint * (tex->width >> level) >= 2) level++;
+                level_shift = tex->width_shift - level;
+                u_shift = 32 - level_shift;
+                v_shift = 32 - (tex->height_shift - level);
+                texels = atlas->texels + tex->offset[level];
+                last_type = type;
+            }
+
+            int u = (uint64_t)(uint32_t)world_x >> u_shift;
+            int v = (uint64_t)(uint32_t)world_y >> v_shift;
+            uint32_t texel = texels[(v << level_shift) + u];
+            if(draw_floor) fill_run(floor_row + x, run[x], shade_texel(texel, SHADE_LIT));
+            if(draw_ceiling) fill_run(ceiling + x, run[x], shade_texel(texel, SHADE_DARK));
+        }
+    }
+    profile_end("floor", start);
+}
+
+static int reserve_sprites(renderer_t *r, int count) {
+    if(count <= r->sprite_capacity) return 0;
+
+    sprite_view_t *views = realloc(r->sprite_views, count * sizeof(sprite_view_t));
+    if(views) r->sprite_views = views;
+    uint32_t *keys = realloc(r->sprite_keys, count * sizeof(uint32_t));
+    if(keys) r->sprite_keys = keys;
+    uint32_t *order = realloc(r->sprite_order, count * sizeof(uint32_t));
+    if(order) r->sprite_order = order;
+    uint32_t *scratch = realloc(r->sprite_scratch, 2 * count * sizeof(uint32_t));
+    if(scratch) r->sprite_scratch = scratch;
+    if(!views || !keys || !order || !scratch) {
+        printf("Failed to allocate sprite buffers\n");
+        return -1;
+    }
+    r->sprite_capacity = count;
+    return 0;
+}
+
+// Projects the sprites in buckets that overlap the view, drops those off
+// screen or behind the farthest wall, and sorts the rest far to near.
+static void collect_sprites(renderer_t *r, const player_t *player, const sprites_t *sprites) {
+    r->sprite_count = 0;
+    if(sprites->count == 0 || sprites->atlas->count == 0 || reserve_sprites(r, sprites->count) < 0) return;
+
+    int width = r->fb.width;
+    int height = r->fb.height;
+    float far = 0;
+    for(int x = 0; x < width; x++) {
+        if(r->hits[x].distance > far) far = r->hits[x].distance;
+    }
+
+    float dir_x = player->dir_x, dir_y = player->dir_y;
+    float plane_x = -dir_y * r->plane_scale;
+    float plane_y = dir_x * r->plane_scale;
+    float pos_x = player->x / BLOCKS_WIDTH;
+    float pos_y = player->y / BLOCKS_HEIGHT;
+    float inv_det = 1 / (plane_x * dir_y - dir_x * plane_y);
+
+    // bounding box of the view triangle, one cell wider for sprite widths
+    float reach = far / BLOCKS_WIDTH + 1;
+    float edge_x[3] = { pos_x, pos_x + (dir_x - plane_x) * reach, pos_x + (dir_x + plane_x) * reach };
+    float edge_y[3] = { pos_y, pos_y + (dir_y - plane_y) * reach, pos_y + (dir_y + plane_y) * reach };
+    float min_x = fminf(edge_x[0], fminf(edge_x[1], edge_x[2])) - 1;
+    float max_x = fmaxf(edge_x[0], fmaxf(edge_x[1], edge_x[2])) + 1;
+    float min_y = fminf(edge_y[0], fminf(edge_y[1], edge_y[2])) - 1;
+    float max_y = fmaxf(edge_y[0], fmaxf(edge_y[1], edge_y[2])) + 1;
+    int bucket_x0 = sprites_bucket_x(sprites, min_x * BLOCKS_WIDTH), bucket_x1 = sprites_bucket_x(sprites, max_x * BLOCKS_WIDTH);
+    int bucket_y0 = sprites_bucket_y(sprites, min_y * BLOCKS_HEIGHT), bucket_y1 = sprites_bucket_y(sprites, max_y * BLOCKS_HEIGHT);
+
+    for(int by = bucket_y0; by <= bucket_y1; by++) {
+        for(int bx = bucket_x0; bx <= bucket_x1; bx++) {
+            int bucket = by * sprites->buckets_x + bx;
+            int first = sprites->bucket_start[bucket], last = sprites->bucket_start[bucket + 1];
+            if(first == last) continue;
+
+            // skip buckets wholly beside, behind or beyond the view
+            int left = 0, right = 0, behind = 0, beyond = 0;
+            for(int corner = 0; corner < 4; corner++) {
+                float cx = ((bx + (corner & 1)) << SPRITE_BUCKET_SHIFT) - pos_x + ((corner & 1) ? 1 : -1);
+                float cy = ((by + (corner >> 1)) << SPRITE_BUCKET_SHIFT) - pos_y + ((corner >> 1) ? 1 : -1);
+                float side = inv_det * (dir_y * cx - dir_x * cy);
+                float depth = inv_det * (-plane_y * cx + plane_x * cy);
+                left += side < -depth;
+                right += side > depth;
+                behind += depth <= 0;
+                beyond += depth > reach;
+            }
+            if(left == 4 || right == 4 || behind == 4 || beyond == 4) continue;
+
+            for(int k = first; k < last; k++) {
+                int id = sprites->order[k];
+                float rel_x = sprites->x[id] / BLOCKS_WIDTH - pos_x;
+                float rel_y = sprites->y[id] / BLOCKS_HEIGHT - pos_y;
+                float side = inv_det * (dir_y * rel_x - dir_x * rel_y);
+                float depth = inv_det * (-plane_y * rel_x + plane_x * rel_y);
+                if(depth < 0.05f || depth * BLOCKS_WIDTH >= far) continue;
+
+                // same vertical scale as walls, so sprites stand on the floor
+                float distance = depth * BLOCKS_WIDTH;
+                float line = height / distance * 25;
+                int line_height = (line > height * 8) ? height * 8 : (int)line;
+                int sprite_height = (int)(line_height * SPRITE_HEIGHT);
+                if(sprite_height < 1) continue;
+
+                const texture_t *tex = &sprites->atlas->textures[sprites->texture[id] % sprites->atlas->count];
+                int sprite_width = (int)((int64_t)sprite_height * tex->width / tex->height);
+                if(sprite_width < 1) sprite_width = 1;
+
+                float centre = ((side / depth + 1) * width - 1) / 2;
+                int x0 = (int)floorf(centre - sprite_width / 2.0f + 0.5f);
+                if(x0 + sprite_width <= 0 || x0 >= width) continue;
+
+                int level = atlas_level(tex, sprite_height);
+                sprite_view_t *view = &r->sprite_views[r->sprite_count];
+                view->depth = distance;
+                view->x0 = x0;
+                view->x1 = x0 + sprite_width;
+                view->bottom = (height - line_height) / 2 + line_height;
+                view->top = view->bottom - sprite_height;
+                view->u_step = ((uint32_t)(tex->width >> level) << 16) / sprite_width;
+                view->v_step = ((uint32_t)(tex->height >> level) << 16) / sprite_height;
+                view->texel = tex->offset[level];
+                view->row_shift = tex->width_shift - level;
+
+                // positive floats order like their bits; inverted for far first
+                uint32_t bits;
+                memcpy(&bits, &distance, sizeof(bits));
+                r->sprite_keys[r->sprite_count] = ~bits;
+                r->sprite_order[r->sprite_count] = r->sprite_count;
+                r->sprite_count++;
+            }
+        }
+    }
+
+    radix_sort(r->sprite_keys, r->sprite_order, r->sprite_scratch, r->sprite_count);
+}
+
+// Draws the sorted sprites into one tile of columns at a time, far to
+// near, skipping columns where a wall is closer. Texels with alpha below
+// one half are holes.
+static void render_sprites(void *ctx, int begin, int end, int worker) {
+    (void)worker;
+    frame_job_t *job = ctx;
+    renderer_t *r = job->r;
+    const uint32_t *texels = job->sprites->atlas->texels;
+    int height = r->fb.height;
+    int stride = r->fb.stride;
+    uint64_t start = profile_begin();
+
+    for(int tile = begin; tile < end; tile += TILE_COLUMNS) {
+        int tile_end = (end - tile < TILE_COLUMNS) ? end : tile + TILE_COLUMNS;
+
+        for(int k = 0; k < r->sprite_count; k++) {
+            const sprite_view_t *view = &r->sprite_views[r->sprite_order[k]];
+            if(view->x1 <= tile || view->x0 >= tile_end) continue;
+
+            int x0 = view->x0 < tile ? tile : view->x0;
+            int x1 = view->x1 > tile_end ? tile_end : view->x1;
+            int y0 = view->top < 0 ? 0 : view->top;
+            int y1 = view->bottom > height ? height : view->bottom;
+
+            for(int x = x0; x < x1; x++) {
+                if(view->depth >= r->hits[x].distance) continue;
+
+                const uint32_t *column = texels + view->texel + (((x - view->x0) * view->u_step) >> 16);
+                uint32_t *pixel = r->fb.pixels + x;
+                uint32_t tex_pos = (y0 - view->top) * view->v_step;
+                for(int y = y0; y < y1; y++) {
+                    uint32_t texel = column[(tex_pos >> 16) << view->row_shift];
+                    tex_pos += view->v_step;
+                    if(texel >> 31) pixel[y * stride] = texel | 0xff000000;
+                }
+            }
+        }
+    }
+    profile_end("sprites", start);
+}
+
+static int same_view(const view_key_t *a, const view_key_t *b) {
+    return a->x == b->x && a->y == b->y && a->map == b->map && a->map_version == b->map_version &&
+           a->fov == b->fov && a->quality == b->quality;
+}
+
+// After a turn in place, a column whose ray falls between two of last
+// frame's rays that hit the same wall face hits that face too, so it is
+// found by intersecting the face instead of walking the grid. That is
+// only sure while the wedge between the two rays is too narrow to hold a
+// wall cell: it is at most depth * plane_scale * 2 / width wide, kept
+// under half a cell. Columns turned into view, next to an edge last
+// frame, or too far away are left to cast, so every hit is the one a
+// cast gives.
+static int reuse_hits(renderer_t *r, const player_t *player, float turn) {
+    int width = r->fb.width;
+    float plane_x = -player->dir_y * r->plane_scale;
+    float plane_y = player->dir_x * r->plane_scale;
+    float pos_x = player->x / (float)BLOCKS_WIDTH;
+    float pos_y = player->y / (float)BLOCKS_HEIGHT;
+    float max_distance = width * BLOCKS_WIDTH / (4 * r->plane_scale);
+    const ray_hit_t *previous = r->previous_hits;
+    int reused = 0;
+
+    // both sets of column angles increase, so one merge walk pairs them
+    int j = 0;
+    for(int i = 0; i < width; i++) {
+        r->hit_known[i] = 0;
+        float angle = turn + r->camera_angle[i];
+        while(j + 1 < width && r->camera_angle[j + 1] < angle) j++;
+        if(j + 1 >= width || r->camera_angle[j] > angle) continue;
+        if(!same_face(&previous[j], &previous[j + 1])) continue;
+        if(previous[j].distance >= max_distance || previous[j + 1].distance >= max_distance) continue;
+
+        float dir_x = player->dir_x + plane_x * r->camera_x[i];
+        float dir_y = player->dir_y + plane_y * r->camera_x[i];
+        if(cast_ray_to_face(&r->hits[i], &previous[j], pos_x, pos_y, dir_x, dir_y)) {
+            if(r->hits[i].distance < 0.1f) r->hits[i].distance = 0.1f;
+            r->hit_known[i] = 1;
+            reused++;
+        }
+    }
+    return reused;
+}
+
+void render_frame(renderer_t *r, const player_t *player, const map_t *map, const sprites_t *sprites) {
+    update_camera(r);
+
+    view_key_t key = {
+        .x = player->x, .y = player->y, .angle = player->angle,
+        .map = map, .map_version = map->version,
+        .sprites = sprites, .sprites_version = sprites ? sprites->version : 0,
+        .fov = r->fov, .quality = r->quality,
+    };
+    frame_job_t job = { .r = r, .player = player, .map = map, .sprites = sprites, .known = NULL };
+
+    r->reused_columns = 0;
+    r->unchanged = 0;
+    atomic_store_explicit(&r->cast_rays, 0, memory_order_relaxed);
+    if(r->cache && r->cache_valid && same_view(&key, &r->cache_key)) {
+        // nothing moved, the framebuffer already holds this frame
+        if(key.angle == r->cache_key.angle && key.sprites == r->cache_key.sprites &&
+           key.sprites_version == r->cache_key.sprites_version) {
+            r->reused_columns = r->fb.width;
+            r->unchanged = 1;
+            return;
+        }
+
+        // at coarser levels the filled-in columns hold copies of their
+        // neighbours' hits, which bound no wedge
+        if(r->column_step == 1) {
+            uint64_t start = profile_begin();
+            memcpy(r->previous_hits, r->hits, r->fb.width * sizeof(ray_hit_t));
+            float turn = key.angle - r->cache_key.angle;
+            if(turn > M_PI) turn -= 2 * M_PI;
+            if(turn < -M_PI) turn += 2 * M_PI;
+            r->reused_columns = reuse_hits(r, player, turn);
+            job.known = r->hit_known;
+            profile_end("reuse", start);
+        }
+    }
+    r->cache_key = key;
+    r->cache_valid = 1;
+
+    threadpool_run(r->pool, r->fb.width, TILE_COLUMNS, render_columns, &job);
+    threadpool_run(r->pool, (r->fb.height + 1) / 2, FLOOR_ROWS, render_rows, &job);
+
+    r->sprite_count = 0;
+    if(sprites) collect_sprites(r, player, sprites);
+    if(r->sprite_count > 0) threadpool_run(r->pool, r->fb.width, TILE_COLUMNS, render_sprites, &job);
+}
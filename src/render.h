@@ -0,0 +1,106 @@
+#pragma once
+
+#include <stdatomic.h>
+
+#include "atlas.h"
+#include "framebuffer.h"
+#include "map.h"
+#include "player.h"
+#include "raycast.h"
+#include "sprite.h"
+#include "threadpool.h"
+
+// Columns per work item: 16 RGBA8 pixels fill one cache line, so tiles
+// never share a line of the framebuffer between threads.
+#define TILE_COLUMNS 16
+// Mirrored floor and ceiling row pairs per work item.
+#define FLOOR_ROWS 8
+
+// Dynamic resolution levels, 0 casts every column and floor row.
+#define RENDER_QUALITY_LEVELS 5
+// Weight of the newest frame in the render time average.
+#define RENDER_EMA 0.1f
+// Frames to wait after a level change before judging it.
+#define RENDER_SETTLE 30
+
+// Everything a frame depends on besides the textures. A frame with the
+// same key as the last is skipped, and one that differs only in angle
+// reuses the last frame's hits where that gives the hit a cast would.
+typedef struct {
+    float x, y, angle;
+    const map_t *map;
+    unsigned map_version;
+    const sprites_t *sprites;
+    unsigned sprites_version;
+    float fov;
+    int quality;
+} view_key_t;
+
+typedef struct {
+    framebuffer_t fb;
+    ray_hit_t *hits;    // one per framebuffer column
+    float fov;
+    threadpool_t *pool;
+    const atlas_t *atlas;   // wall textures, owned by the caller
+
+    // Camera plane model: column i casts along dir + plane * camera_x[i],
+    // with plane = perpendicular(dir) * plane_scale. Rebuilt only when the
+    // FOV changes, so no trig runs per column.
+    float *camera_x;
+    float *camera_angle;    // ray angle of each column off the view direction
+    float camera_fov;
+    float plane_scale;
+
+    // Column x holds wall pixels in rows [wall_top[x], wall_bottom[x]); the
+    // floor pass writes only outside that span.
+    int *wall_top;
+    int *wall_bottom;
+
+    // Visible sprites of the current frame, grown as needed. sprite_order
+    // lists them far to near after sorting on sprite_keys.
+    sprite_view_t *sprite_views;
+    uint32_t *sprite_keys;
+    uint32_t *sprite_order;
+    uint32_t *sprite_scratch;
+    int sprite_capacity;
+    int sprite_count;
+
+    // Coarser quality levels cast every column_step-th column and every
+    // row_step-th floor row, sample one wall texel per row_step rows, and
+    // fill the rest from their neighbours. With a budget, renderer_adapt
+    // picks the level from the average render time.
+    int quality;
+    int column_step;
+    int row_step;
+    int *column_run;        // columns drawn from column x, 0 if it repeats one
+    float budget_ms;        // 0 keeps the level fixed
+    float frame_ms;
+    int settle;
+
+    // Visibility cache, see view_key_t. hit_known marks the columns whose
+    // hits came from previous_hits this frame.
+    int cache;              // 0 renders every frame in full
+    view_key_t cache_key;
+    int cache_valid;
+    ray_hit_t *previous_hits;
+    int *hit_known;
+    int reused_columns;     // columns not cast last frame
+    int unchanged;          // last frame was skipped, r->fb is as it was
+    atomic_int cast_rays;   // rays cast by the last frame
+} renderer_t;
+
+// threads <= 0 uses every online CPU.
+int renderer_init(renderer_t *r, const atlas_t *atlas, int width, int height, int threads);
+void renderer_free(renderer_t *r);
+
+void renderer_set_quality(renderer_t *r, int quality);
+// Feeds the time the last render_frame took and steps the quality level
+// one way or the other when the average leaves the budget.
+void renderer_adapt(renderer_t *r, double frame_ms);
+
+// Casts one ray per column and draws the walls, then casts the floor and
+// ceiling a row at a time, then draws sprites (may be NULL) clipped against
+// the walls into r->fb. Touches no GL state, so it can run without a window.
+// With r->cache set it returns at once when nothing changed since the last
+// call, so r->fb must not be drawn over between frames.
+void render_frame(renderer_t *r, const player_t *player, const map_t *map, const sprites_t *sprites);
@@ -0,0 +1,131 @@
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "profiler.h"
+#include "sim.h"
+
+#define TICK (1.0 / SIM_RATE)
+// Falling further behind than this drops ticks instead of catching up,
+// so a stall does not turn into a burst of fast movement.
+#define MAX_LAG 0.25
+#define FRESH 4
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void sleep_until(double time) {
+    struct timespec ts;
+    ts.tv_sec = (time_t)time;
+    ts.tv_nsec = (long)((time - ts.tv_sec) * 1e9);
+    // returns the error instead of setting errno; only a signal is retried
+    while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR);
+}
+
+static unsigned pack_input(const input_t *input) {
+    return (input->forward != 0) | (input->backward != 0) << 1 | (input->left != 0) << 2 | (input->right != 0) << 3;
+}
+
+void sim_set_input(sim_t *sim, const input_t *input) {
+    atomic_store_explicit(&sim->keys, pack_input(input), memory_order_relaxed);
+}
+
+void sim_get_input(const sim_t *sim, input_t *input) {
+    unsigned keys = atomic_load_explicit(&sim->keys, memory_order_relaxed);
+    input->forward = keys & 1;
+    input->backward = keys >> 1 & 1;
+    input->left = keys >> 2 & 1;
+    input->right = keys >> 3 & 1;
+}
+
+double sim_time(const sim_t *sim) {
+    return now() - sim->start;
+}
+
+static void publish(sim_t *sim, const player_t *previous, double time) {
+    sim_frame_t *frame = &sim->frames[sim->back];
+    frame->previous = *previous;
+    frame->current = sim->player;
+    frame->time = time;
+    sim->back = atomic_exchange_explicit(&sim->middle, sim->back | FRESH, memory_order_acq_rel) & ~FRESH;
+}
+
+static void *run(void *arg) {
+    sim_t *sim = arg;
+    long tick = 0;
+
+    while(atomic_load_explicit(&sim->running, memory_order_relaxed)) {
+        tick++;
+        double due = tick * TICK;
+        double late = sim_time(sim) - due;
+        if(late > MAX_LAG) tick += (long)(late / TICK);
+        else if(late < 0) sleep_until(sim->start + due);
+
+        uint64_t start = profile_begin();
+        input_t input;
+        sim_get_input(sim, &input);
+        if(sim->trace) trace_record(sim->trace, tick * TICK, &input);
+
+        player_t previous = sim->player;
+        handle_movement(&sim->player, &input, sim->map, TICK);
+        publish(sim, &previous, tick * TICK);
+        profile_end("tick", start);
+    }
+    return NULL;
+}
+
+int sim_start(sim_t *sim, const map_t *map, const player_t *player, trace_t *trace) {
+    memset(sim, 0, sizeof(sim_t));
+    sim->map = map;
+    sim->trace = trace;
+    sim->player = *player;
+
+    for(int i = 0; i < 3; i++) {
+        sim->frames[i].previous = *player;
+        sim->frames[i].current = *player;
+    }
+    sim->front = 0;
+    atomic_init(&sim->middle, 1);
+    sim->back = 2;
+
+    sim->start = now();
+    atomic_init(&sim->running, 1);
+    if(pthread_create(&sim->thread, NULL, run, sim) != 0) {
+        printf("Failed to start simulation thread\n");
+        return -1;
+    }
+    return 0;
+}
+
+void sim_stop(sim_t *sim) {
+    atomic_store_explicit(&sim->running, 0, memory_order_relaxed);
+    pthread_join(sim->thread, NULL);
+}
+
+void sim_interpolate(sim_t *sim, player_t *player) {
+    if(atomic_load_explicit(&sim->middle, memory_order_relaxed) & FRESH) {
+        sim->front = atomic_exchange_explicit(&sim->middle, sim->front, memory_order_acq_rel) & ~FRESH;
+    }
+
+    const sim_frame_t *frame = &sim->frames[sim->front];
+    float alpha = (sim_time(sim) - frame->time) * SIM_RATE;
+    if(alpha < 0) alpha = 0;
+    if(alpha > 1) alpha = 1;
+
+    const player_t *a = &frame->previous;
+    const player_t *b = &frame->current;
+    *player = *b;
+    player->x = a->x + (b->x - a->x) * alpha;
+    player->y = a->y + (b->y - a->y) * alpha;
+
+    // turn the short way round when the angle wraps
+    float turn = b->angle - a->angle;
+    if(turn > M_PI) turn -= 2 * M_PI;
+    if(turn < -M_PI) turn += 2 * M_PI;
+    player_set_angle(player, a->angle + turn * alpha);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "map.h"
+#include "player.h"
+#include "trace.h"
+
+// Simulation ticks per second. Movement always advances by exactly one
+// tick, however long frames take.
+#define SIM_RATE 240
+
+// Two consecutive ticks, so the renderer can blend between them.
+typedef struct {
+    player_t previous;
+    player_t current;
+    double time;        // seconds since start when current was simulated
+} sim_frame_t;
+
+typedef struct {
+    pthread_t thread;
+    atomic_int running;
+    atomic_uint keys;       // input_t packed into bits, set by the window thread
+    const map_t *map;
+    trace_t *trace;         // records input per tick when not NULL
+    player_t player;        // owned by the simulation thread
+    double start;
+
+    // Triple buffer: the simulation thread fills frames[back], then swaps
+    // it with the middle slot; the renderer swaps the middle slot into
+    // front whenever it is marked fresh. Nobody ever waits.
+    sim_frame_t frames[3];
+    atomic_int middle;
+    int back;
+    int front;
+} sim_t;
+
+// Starts ticking from the given player state. The map must stay alive
+// and unedited until sim_stop.
+int sim_start(sim_t *sim, const map_t *map, const player_t *player, trace_t *trace);
+void sim_stop(sim_t *sim);
+
+void sim_set_input(sim_t *sim, const input_t *input);
+void sim_get_input(const sim_t *sim, input_t *input);
+
+// Player pose for rendering right now, blended between the two newest
+// ticks. Rendering runs one tick behind the simulation in exchange for
+// smooth motion at any frame rate. Call from one thread only.
+void sim_interpolate(sim_t *sim, player_t *player);
+
+// Seconds since sim_start on the simulation clock.
+double sim_time(const sim_t *sim);
@@ -0,0 +1,112 @@
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sprite.h"
+
+// Shared by every sprite set, like map versions, so a set initialized
+// where a freed one lived never repeats a version a cache has seen.
+static atomic_uint sprite_versions;
+
+static unsigned next_version(void) {
+    return atomic_fetch_add(&sprite_versions, 1) + 1;
+}
+
+int sprites_init(sprites_t *sprites, const atlas_t *atlas, const map_t *map, int capacity) {
+    memset(sprites, 0, sizeof(sprites_t));
+    sprites->version = next_version();
+    if(capacity < 1) capacity = 1;
+    sprites->atlas = atlas;
+    sprites->buckets_x = (map->width + (1 << SPRITE_BUCKET_SHIFT) - 1) >> SPRITE_BUCKET_SHIFT;
+    sprites->buckets_y = (map->height + (1 << SPRITE_BUCKET_SHIFT) - 1) >> SPRITE_BUCKET_SHIFT;
+
+    size_t buckets = (size_t)sprites->buckets_x * sprites->buckets_y;
+    sprites->x = malloc(capacity * sizeof(float));
+    sprites->y = malloc(capacity * sizeof(float));
+    sprites->texture = malloc(capacity * sizeof(uint16_t));
+    sprites->order = malloc(capacity * sizeof(int));
+    sprites->bucket_start = calloc(buckets + 1, sizeof(int));
+    sprites->bucket_fill = malloc(buckets * sizeof(int));
+    if(!sprites->x || !sprites->y || !sprites->texture || !sprites->order || !sprites->bucket_start || !sprites->bucket_fill) {
+        printf("Failed to allocate %d sprites\n", capacity);
+        sprites_free(sprites);
+        return -1;
+    }
+    sprites->capacity = capacity;
+    return 0;
+}
+
+void sprites_free(sprites_t *sprites) {
+    free(sprites->x);
+    free(sprites->y);
+    free(sprites->texture);
+    free(sprites->order);
+    free(sprites->bucket_start);
+    free(sprites->bucket_fill);
+    memset(sprites, 0, sizeof(sprites_t));
+}
+
+int sprites_add(sprites_t *sprites, float x, float y, int texture) {
+    if(sprites->count == sprites->capacity) return -1;
+
+    int i = sprites->count++;
+    sprites->x[i] = x;
+    sprites->y[i] = y;
+    sprites->texture[i] = texture;
+    return i;
+}
+
+void sprites_index(sprites_t *sprites) {
+    int buckets = sprites->buckets_x * sprites->buckets_y;
+    memset(sprites->bucket_start, 0, (buckets + 1) * sizeof(int));
+
+    for(int i = 0; i < sprites->count; i++) {
+        int bucket = sprites_bucket_y(sprites, sprites->y[i]) * sprites->buckets_x + sprites_bucket_x(sprites, sprites->x[i]);
+        sprites->bucket_start[bucket + 1]++;
+    }
+    for(int b = 0; b < buckets; b++) {
+        sprites->bucket_start[b + 1] += sprites->bucket_start[b];
+        sprites->bucket_fill[b] = sprites->bucket_start[b];
+    }
+    for(int i = 0; i < sprites->count; i++) {
+        int bucket = sprites_bucket_y(sprites, sprites->y[i]) * sprites->buckets_x + sprites_bucket_x(sprites, sprites->x[i]);
+        sprites->order[sprites->bucket_fill[bucket]++] = i;
+    }
+    sprites->version = next_version();
+}
+
+void sprites_scatter(sprites_t *sprites, const map_t *map, int count, int texture, unsigned seed) {
+    srand(seed);
+    for(int i = 0; i < count; i++) {
+        int x, y, tries = 0;
+        do {
+            x = rand() % map->width;
+            y = rand() % map->height;
+        } while(map_is_wall(map, x, y) && ++tries < 1000);
+        if(tries == 1000) break;
+        if(sprites_add(sprites, (x + 0.5f) * BLOCKS_WIDTH, (y + 0.5f) * BLOCKS_HEIGHT, texture) < 0) break;
+    }
+    sprites_index(sprites);
+}
+
+void radix_sort(uint32_t *keys, uint32_t *values, uint32_t *scratch, int count) {
+    uint32_t *src_keys = keys, *src_values = values;
+    uint32_t *dst_keys = scratch, *dst_values = scratch + count;
+
+    for(int shift = 0; shift < 32; shift += 8) {
+        int offsets[257] = { 0 };
+        for(int i = 0; i < count; i++) offsets[(src_keys[i] >> shift & 0xff) + 1]++;
+        for(int b = 0; b < 256; b++) offsets[b + 1] += offsets[b];
+
+        for(int i = 0; i < count; i++) {
+            int slot = offsets[src_keys[i] >> shift & 0xff]++;
+            dst_keys[slot] = src_keys[i];
+            dst_values[slot] = src_values[i];
+        }
+
+        uint32_t *swap = src_keys; src_keys = dst_keys; dst_keys = swap;
+        swap = src_values; src_values = dst_values; dst_values = swap;
+    }
+    // four passes leave the result back in keys and values
+}
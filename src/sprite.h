@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "atlas.h"
+#include "map.h"
+#include "utils.h"
+
+// Buckets of the spatial index cover 8x8 map cells, like occupancy tiles.
+#define SPRITE_BUCKET_SHIFT 3
+// Sprite height as a fraction of a wall's, standing on the floor.
+#define SPRITE_HEIGHT 0.6f
+
+// Billboards in structure-of-arrays form. After adding or moving sprites,
+// sprites_index rebuilds the bucket grid the renderer culls with.
+typedef struct {
+    const atlas_t *atlas;   // sprite textures, owned by the caller
+    int count;
+    int capacity;
+    float *x;               // world units
+    float *y;
+    uint16_t *texture;
+
+    // Counting-sorted index: the sprites in bucket b are
+    // order[bucket_start[b]] .. order[bucket_start[b + 1] - 1].
+    int buckets_x, buckets_y;
+    int *bucket_start;
+    int *bucket_fill;
+    int *order;
+    unsigned version;       // changes on init and every sprites_index
+} sprites_t;
+
+// Screen-space span of one visible sprite for this frame.
+typedef struct {
+    float depth;        // perpendicular distance in world units
+    int x0, x1;         // columns, x1 exclusive, may lie off screen
+    int top, bottom;    // rows, bottom exclusive, may lie off screen
+    uint32_t u_step;    // 16.16 fixed point texels per pixel
+    uint32_t v_step;
+    uint32_t texel;     // first texel of the mip level in the atlas
+    int row_shift;      // log2 of the mip level width
+} sprite_view_t;
+
+int sprites_init(sprites_t *sprites, const atlas_t *atlas, const map_t *map, int capacity);
+void sprites_free(sprites_t *sprites);
+// Returns the new sprite's index, or -1 when full.
+int sprites_add(sprites_t *sprites, float x, float y, int texture);
+void sprites_index(sprites_t *sprites);
+
+// Adds count sprites at the centres of random empty cells and reindexes.
+void sprites_scatter(sprites_t *sprites, const map_t *map, int count, int texture, unsigned seed);
+
+static inline int sprites_bucket_x(const sprites_t *sprites, float x) {
+    int bucket = (int)(x / BLOCKS_WIDTH) >> SPRITE_BUCKET_SHIFT;
+    return bucket < 0 ? 0 : bucket >= sprites->buckets_x ? sprites->buckets_x - 1 : bucket;
+}
+
+static inline int sprites_bucket_y(const sprites_t *sprites, float y) {
+    int bucket = (int)(y / BLOCKS_HEIGHT) >> SPRITE_BUCKET_SHIFT;
+    return bucket < 0 ? 0 : bucket >= sprites->buckets_y ? sprites->buckets_y - 1 : bucket;
+}
+
+// Sorts count 32-bit keys ascending, carrying values along, in four 8-bit
+// passes. scratch holds 2 * count entries.
+void radix_sort(uint32_t *keys, uint32_t *values, uint32_t *scratch, int count);
@@ -1,5 +0,0 @@
-#include <SDL2/SDL_render.h>
-
-#include "textures.h"
-
-int all_textures[3*32*32*21] = { 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 190, 190, 190, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 48, 25, 41, 63, 50, 52, 79, 58, 62, 109, 70, 59, 116, 60, 57, 106, 64, 66, 126, 91, 82, 124, 77, 72, 108, 79, 76, 33, 31, 48, 80, 48, 57, 75, 57, 67, 118, 69, 63, 109, 70, 59, 50, 32, 47, 49, 44, 47, 67, 52, 58, 112, 76, 60, 121, 77, 69, 123, 56, 58, 121, 75, 66, 73, 43, 50, 88, 55, 57, 29, 35, 42, 66, 35, 47, 43, 45, 64, 109, 63, 62, 113, 62, 57, 117, 64, 66, 128, 79, 71, 92, 66, 71, 92, 60, 62, 22, 36, 58, 68, 42, 44, 55, 35, 46, 109, 70, 59, 117, 67, 60, 118, 76, 74, 126, 78, 65, 79, 52, 60, 45, 34, 45, 81, 55, 50, 80, 48, 57, 120, 68, 58, 133, 74, 63, 122, 68, 64, 121, 75, 66, 44, 26, 39, 68, 42, 44, 55, 35, 46, 107, 66, 58, 111, 66, 66, 79, 52, 60, 73, 43, 50, 29, 35, 42, 60, 33, 45, 53, 51, 48, 121, 75, 66, 117, 64, 66, 106, 58, 55, 126, 78, 65, 76, 66, 72, 73, 49, 61, 33, 31, 48, 69, 28, 47, 44, 26, 39, 53, 51, 48, 49, 35, 51, 105, 71, 74, 125, 72, 62, 76, 55, 54, 45, 43, 58, 75, 57, 67, 72, 40, 50, 123, 79, 62, 109, 70, 59, 105, 71, 74, 134, 77, 71, 109, 63, 62, 121, 77, 69, 48, 25, 41, 53, 51, 48, 49, 35, 51, 79, 52, 60, 73, 43, 50, 49, 44, 53, 68, 42, 44, 49, 35, 51, 106, 64, 66, 118, 64, 56, 122, 68, 64, 138, 70, 65, 87, 53, 55, 94, 59, 52, 49, 46, 60, 46, 38, 47, 114, 68, 67, 121, 78, 76, 49, 33, 42, 44, 47, 65, 75, 50, 63, 91, 64, 71, 45, 33, 44, 50, 36, 52, 50, 36, 52, 114, 68, 67, 115, 63, 64, 126, 76, 59, 109, 60, 57, 128, 74, 63, 91, 49, 52, 88, 47, 53, 30, 35, 43, 54, 52, 49, 60, 39, 49, 124, 75, 64, 107, 73, 76, 44, 28, 49, 42, 23, 40, 48, 39, 49, 64, 37, 47, 123, 70, 60, 110, 67, 60, 94, 62, 63, 73, 59, 71, 30, 35, 43, 71, 29, 49, 54, 52, 49, 126, 72, 61, 128, 72, 67, 128, 72, 67, 26, 22, 39, 34, 33, 51, 43, 24, 41, 69, 44, 50, 73, 30, 50, 119, 65, 60, 128, 72, 58, 127, 81, 73, 126, 72, 61, 138, 88, 79, 85, 50, 55, 77, 45, 53, 34, 33, 51, 66, 54, 67, 69, 50, 62, 129, 78, 60, 143, 85, 68, 124, 67, 59, 124, 80, 78, 55, 19, 43, 46, 28, 41, 50, 57, 70, 47, 39, 57, 77, 45, 53, 92, 52, 63, 35, 26, 48, 73, 30, 50, 71, 52, 59, 112, 61, 58, 132, 61, 62, 139, 94, 70, 132, 85, 66, 127, 74, 67, 47, 34, 46, 46, 29, 52, 70, 45, 51, 65, 65, 75, 126, 72, 64, 127, 82, 79, 127, 82, 79, 135, 84, 69, 78, 53, 65, 98, 62, 62, 55, 34, 40, 71, 38, 51, 70, 51, 63, 123, 77, 75, 116, 85, 82, 123, 77, 75, 136, 89, 70, 113, 68, 70, 130, 83, 74, 55, 49, 48, 26, 22, 40, 95, 60, 62, 100, 58, 63, 35, 33, 52, 66, 40, 59, 72, 60, 70, 119, 71, 70, 115, 70, 62, 120, 77, 65, 118, 72, 64, 138, 100, 90, 134, 75, 70, 133, 68, 64, 52, 35, 45, 75, 46, 48, 76, 60, 55, 134, 75, 70, 133, 85, 76, 132, 75, 64, 101, 70, 70, 78, 63, 76, 36, 34, 53, 68, 41, 60, 82, 52, 58, 117, 64, 61, 130, 84, 81, 133, 85, 76, 117, 64, 61, 135, 87, 68, 147, 88, 72, 126, 79, 77, 115, 78, 81, 54, 48, 58, 56, 35, 41, 53, 28, 45, 69, 56, 70, 69, 56, 70, 130, 84, 81, 120, 77, 65, 130, 84, 81, 126, 79, 77, 135, 62, 64, 133, 82, 73, 148, 90, 75, 124, 68, 63, 120, 69, 68, 37, 46, 47, 66, 36, 50, 69, 48, 56, 123, 83, 66, 88, 68, 60, 96, 58, 60, 52, 35, 45, 69, 40, 50, 69, 40, 50, 117, 64, 61, 122, 73, 72, 129, 70, 72, 135, 81, 63, 133, 88, 83, 120, 77, 65, 129, 70, 72, 151, 89, 68, 143, 83, 70, 47, 30, 53, 42, 40, 59, 57, 44, 60, 74, 57, 64, 135, 81, 63, 135, 81, 63, 126, 79, 77, 122, 73, 72, 130, 84, 81, 135, 81, 63, 128, 66, 63, 129, 70, 72, 139, 84, 75, 130, 70, 62, 129, 70, 72, 55, 35, 52, 72, 46, 52, 50, 34, 48, 75, 46, 48, 57, 20, 45, 26, 30, 54, 54, 48, 52, 75, 46, 48, 130, 70, 62, 119, 87, 84, 117, 64, 61, 123, 68, 69, 133, 85, 76, 135, 87, 68, 139, 91, 72, 87, 57, 66, 96, 54, 66, 52, 35, 45, 26, 30, 54, 76, 31, 52, 68, 45, 53, 135, 81, 63, 133, 82, 73, 120, 69, 68, 115, 78, 81, 135, 81, 63, 117, 64, 61, 129, 74, 66, 119, 87, 84, 133, 82, 73, 148, 84, 69, 136, 85, 79, 119, 87, 84, 49, 47, 64, 56, 50, 49, 36, 34, 53, 24, 40, 64, 54, 51, 66, 32, 38, 46, 52, 60, 73, 60, 39, 51, 123, 68, 69, 115, 78, 81, 115, 78, 81, 130, 70, 62, 138, 100, 90, 103, 72, 62, 97, 61, 63, 27, 23, 41, 69, 55, 57, 30, 50, 67, 59, 38, 57, 68, 45, 53, 54, 39, 56, 120, 69, 68, 129, 74, 66, 123, 68, 69, 133, 88, 83, 133, 85, 76, 128, 66, 63, 133, 88, 83, 116, 70, 72, 150, 83, 71, 88, 68, 60, 84, 61, 59, 36, 34, 53, 68, 47, 61, 89, 60, 55, 116, 70, 72, 133, 85, 76, 124, 68, 63, 54, 48, 58, 63, 50, 65, 69, 48, 56, 123, 68, 69, 119, 87, 84, 129, 74, 66, 103, 45, 58, 103, 72, 62, 26, 30, 54, 73, 46, 61, 73, 46, 61, 135, 87, 68, 32, 38, 46, 74, 54, 62, 75, 46, 48, 69, 56, 70, 122, 73, 72, 116, 70, 72, 123, 83, 66, 135, 62, 64, 135, 62, 64, 129, 74, 66, 138, 86, 71, 103, 72, 62, 92, 63, 71, 27, 23, 41, 89, 60, 55, 87, 61, 66, 86, 46, 57, 150, 83, 71, 150, 95, 80, 133, 88, 83, 128, 66, 63, 53, 41, 51, 74, 54, 62, 59, 38, 57, 88, 51, 63, 84, 53, 63, 102, 59, 55, 56, 50, 49, 82, 52, 58, 67, 67, 77, 119, 87, 84, 151, 89, 77, 120, 77, 65, 42, 40, 59, 69, 40, 50, 54, 39, 56, 72, 46, 52, 120, 69, 68, 122, 73, 72, 116, 70, 72, 135, 62, 64, 148, 97, 87, 87, 57, 66, 99, 59, 59, 48, 35, 47, 66, 50, 56, 85, 53, 57, 74, 46, 56, 120, 77, 65, 133, 88, 83, 133, 82, 73, 147, 85, 78, 122, 73, 72, 129, 70, 72, 52, 35, 45, 59, 38, 57, 76, 53, 50, 84, 61, 59, 48, 29, 43, 77, 57, 70, 87, 68, 77, 128, 66, 63, 117, 64, 61, 144, 92, 83, 151, 101, 90, 133, 68, 64, 48, 35, 47, 74, 54, 62, 69, 56, 70, 69, 48, 56, 76, 60, 55, 122, 73, 72, 134, 75, 61, 97, 69, 76, 103, 45, 58, 53, 41, 51, 73, 46, 61, 83, 55, 61, 77, 57, 70, 132, 75, 64, 120, 69, 68, 134, 75, 61, 117, 64, 61, 134, 75, 70, 138, 86, 71, 126, 79, 77, 133, 68, 64, 55, 35, 52, 42, 40, 59, 53, 28, 45, 86, 59, 62, 64, 42, 53, 135, 81, 63, 120, 69, 68, 122, 73, 72, 120, 69, 68, 142, 83, 75, 147, 85, 78, 123, 68, 69, 53, 41, 51, 51, 42, 52, 74, 57, 64, 74, 54, 62, 75, 46, 58, 102, 59, 55, 103, 72, 62, 24, 40, 64, 76, 53, 50, 59, 38, 57, 50, 34, 48, 117, 64, 61, 133, 68, 64, 133, 82, 73, 123, 83, 66, 122, 73, 72, 133, 80, 69, 150, 95, 80, 83, 72, 79, 97, 53, 56, 24, 40, 64, 55, 35, 52, 36, 34, 53, 76, 53, 50, 76, 60, 55, 133, 80, 69, 132, 75, 64, 134, 75, 61, 118, 72, 64, 134, 75, 61, 142, 96, 72, 147, 88, 72, 128, 66, 63, 56, 43, 43, 47, 50, 70, 55, 35, 52, 56, 50, 49, 53, 41, 51, 47, 30, 53, 56, 35, 41, 49, 41, 60, 54, 48, 52, 135, 81, 63, 123, 68, 69, 130, 76, 69, 133, 82, 73, 119, 87, 84, 115, 78, 81, 135, 92, 87, 101, 70, 70, 84, 61, 59, 47, 30, 53, 73, 63, 58, 67, 67, 77, 27, 23, 41, 50, 34, 48, 66, 36, 50, 75, 46, 48, 126, 79, 77, 129, 74, 66, 130, 84, 81, 132, 75, 64, 122, 73, 72, 143, 83, 70, 135, 92, 87, 133, 80, 69, 32, 38, 46, 89, 39, 56, 129, 70, 72, 133, 85, 76, 54, 48, 58, 47, 30, 53, 63, 50, 65, 69, 48, 56, 126, 79, 77, 126, 79, 77, 135, 81, 63, 129, 70, 72, 130, 70, 62, 151, 89, 77, 84, 61, 59, 80, 47, 55, 56, 35, 41, 64, 42, 53, 89, 60, 55, 130, 70, 62, 134, 75, 70, 49, 47, 64, 73, 39, 52, 74, 57, 64, 57, 44, 60, 129, 70, 72, 122, 73, 72, 118, 72, 64, 130, 84, 81, 139, 91, 72, 87, 57, 66, 100, 52, 59, 37, 27, 50, 133, 68, 64, 136, 85, 79, 133, 68, 64, 116, 70, 72, 27, 23, 41, 51, 42, 52, 76, 53, 50, 57, 44, 60, 116, 70, 72, 119, 87, 84, 118, 72, 64, 117, 64, 61, 96, 54, 66, 101, 66, 68, 37, 46, 47, 79, 44, 55, 69, 55, 57, 137, 79, 68, 141, 87, 78, 122, 73, 72, 118, 72, 64, 39, 28, 44, 75, 46, 48, 69, 40, 50, 74, 54, 62, 134, 75, 70, 128, 66, 63, 149, 89, 71, 102, 59, 65, 103, 65, 57, 49, 37, 50, 72, 52, 64, 116, 70, 72, 128, 66, 63, 141, 87, 78, 133, 68, 64, 134, 75, 61, 42, 40, 59, 76, 60, 55, 51, 42, 52, 74, 61, 72, 135, 81, 63, 129, 74, 66, 103, 45, 58, 102, 59, 65, 48, 29, 43, 64, 48, 65, 68, 47, 61, 134, 75, 61, 133, 85, 76, 137, 79, 68, 141, 87, 78, 120, 69, 68, 123, 83, 66, 53, 28, 45, 74, 57, 64, 54, 39, 56, 68, 41, 60, 47, 50, 70, 84, 61, 59, 103, 72, 62, 45, 25, 43, 82, 63, 74, 130, 84, 81, 120, 69, 68, 134, 75, 61, 144, 92, 83, 135, 92, 87, 134, 75, 61, 55, 35, 52, 56, 43, 43, 58, 56, 53, 76, 31, 52, 54, 48, 52, 47, 50, 70, 101, 66, 68, 29, 32, 45, 85, 53, 57, 82, 48, 55, 118, 72, 64, 128, 66, 63, 129, 70, 72, 115, 78, 81, 150, 93, 76, 137, 79, 68, 123, 83, 66, 120, 77, 65, 45, 25, 43, 48, 29, 43, 27, 23, 41, 27, 23, 41, 56, 43, 43, 37, 27, 50, 72, 52, 64, 120, 69, 68, 120, 69, 68, 135, 81, 63, 116, 70, 72, 147, 85, 78, 92, 63, 71, 100, 52, 59, 37, 27, 50, 56, 43, 43, 27, 23, 41, 54, 44, 55, 57, 20, 45, 37, 27, 50, 47, 30, 53, 27, 23, 41, 49, 41, 60, 67, 67, 77, 130, 70, 62, 135, 62, 64, 130, 84, 81, 130, 70, 62, 132, 75, 64, 152, 94, 70, 141, 87, 78, 148, 97, 87, 36, 34, 53, 27, 23, 41, 74, 46, 56, 77, 57, 70, 132, 75, 64, 54, 48, 58, 75, 46, 48, 124, 68, 63, 135, 62, 64, 130, 70, 62, 148, 90, 75, 97, 61, 63, 82, 56, 58, 39, 28, 44, 82, 48, 55, 83, 55, 61, 66, 50, 56, 72, 52, 65, 133, 88, 83, 129, 70, 72, 36, 34, 53, 55, 35, 52, 69, 48, 56, 50, 34, 48, 135, 87, 68, 133, 85, 76, 116, 70, 72, 120, 77, 65, 126, 79, 77, 138, 100, 90, 92, 63, 71, 87, 57, 66, 53, 28, 45, 88, 53, 53, 86, 59, 62, 64, 48, 65, 138, 86, 71, 130, 84, 81, 49, 47, 64, 68, 45, 53, 119, 87, 84, 134, 75, 70, 87, 57, 66, 87, 57, 66, 42, 40, 59, 89, 60, 55, 67, 67, 77, 126, 79, 77, 130, 84, 81, 120, 77, 65, 148, 97, 87, 130, 84, 81, 130, 84, 81, 53, 28, 45, 75, 46, 48, 2, 2, 2, 47, 50, 70, 126, 79, 77, 129, 74, 66, 135, 87, 68, 137, 79, 68, 101, 70, 70, 97, 69, 76, 27, 23, 41, 82, 52, 58, 81, 48, 64, 72, 52, 65, 115, 78, 81, 151, 98, 82, 149, 89, 71, 133, 85, 76, 55, 35, 52, 76, 60, 55, 101, 70, 70, 103, 65, 57, 53, 41, 51, 27, 23, 41, 87, 61, 66, 64, 48, 65, 118, 72, 64, 122, 73, 72, 126, 79, 77, 135, 81, 63, 152, 94, 70, 133, 85, 76, 122, 73, 72, 42, 40, 59, 68, 41, 60, 60, 39, 51, 75, 46, 48, 129, 70, 72, 120, 77, 65, 101, 73, 78, 103, 65, 57, 47, 30, 53, 72, 52, 65, 64, 42, 53, 82, 48, 55, 130, 70, 62, 132, 75, 64, 129, 74, 66, 142, 96, 72, 142, 96, 72, 130, 76, 69, 45, 25, 43, 37, 46, 47, 52, 35, 45, 24, 40, 64, 32, 38, 46, 72, 52, 65, 89, 39, 56, 133, 82, 73, 115, 78, 81, 120, 69, 68, 133, 82, 73, 135, 81, 63, 147, 88, 72, 135, 62, 64, 116, 70, 72, 52, 35, 45, 68, 41, 60, 57, 44, 60, 84, 61, 59, 103, 72, 62, 101, 70, 70, 37, 27, 50, 50, 34, 48, 67, 67, 77, 82, 48, 55, 134, 75, 61, 120, 77, 65, 116, 70, 72, 135, 62, 64, 134, 75, 61, 80, 47, 55, 99, 59, 59, 55, 35, 52, 87, 64, 68, 87, 64, 68, 36, 34, 53, 42, 40, 59, 69, 55, 57, 62, 57, 74, 132, 75, 64, 123, 68, 69, 129, 74, 66, 120, 69, 68, 120, 69, 68, 129, 74, 66, 142, 83, 75, 138, 100, 90, 120, 77, 65, 27, 23, 41, 69, 48, 56, 76, 60, 55, 52, 60, 73, 48, 29, 43, 24, 40, 64, 47, 50, 70, 59, 38, 57, 74, 46, 56, 119, 87, 84, 120, 77, 65, 133, 88, 83, 115, 78, 81, 87, 57, 66, 103, 72, 62, 49, 47, 64, 67, 67, 77, 114, 62, 60, 136, 89, 70, 81, 54, 60, 52, 27, 44, 74, 52, 49, 48, 40, 59, 130, 66, 62, 113, 68, 70, 119, 71, 70, 127, 82, 79, 131, 73, 60, 130, 80, 71, 136, 89, 70, 101, 70, 61, 86, 50, 62, 36, 26, 49, 25, 29, 53, 87, 65, 59, 132, 61, 62, 126, 72, 64, 29, 49, 65, 58, 37, 56, 67, 47, 55, 62, 49, 63, 130, 83, 74, 121, 66, 62, 130, 83, 74, 78, 53, 65, 101, 63, 56, 30, 28, 48, 70, 51, 63, 67, 54, 56, 127, 78, 70, 121, 76, 74, 133, 87, 69, 126, 72, 61, 50, 33, 43, 50, 57, 70, 66, 54, 67, 115, 66, 65, 126, 72, 61, 115, 66, 65, 124, 67, 59, 138, 88, 79, 80, 58, 56, 98, 56, 62, 29, 48, 64, 29, 48, 64, 78, 50, 55, 85, 64, 57, 144, 85, 65, 115, 66, 65, 118, 65, 66, 35, 26, 48, 71, 52, 59, 70, 49, 55, 63, 34, 48, 127, 84, 79, 97, 63, 65, 96, 50, 56, 51, 27, 43, 83, 58, 63, 85, 57, 53, 112, 61, 58, 109, 60, 57, 115, 77, 62, 140, 87, 71, 88, 47, 53, 24, 28, 50, 53, 19, 42, 54, 52, 49, 64, 45, 52, 64, 52, 65, 94, 62, 63, 90, 54, 56, 93, 49, 55, 94, 68, 73, 39, 37, 55, 25, 21, 38, 74, 41, 51, 81, 63, 72, 118, 74, 72, 121, 65, 58, 130, 85, 67, 126, 76, 59, 115, 63, 64, 49, 33, 42, 63, 38, 56, 53, 41, 56, 63, 38, 56, 94, 62, 63, 50, 48, 62, 64, 51, 53, 69, 43, 52, 123, 70, 60, 110, 67, 60, 117, 67, 60, 125, 72, 62, 76, 66, 72, 34, 25, 45, 44, 26, 39, 123, 74, 57, 108, 79, 76, 49, 44, 53, 46, 38, 47, 66, 46, 52, 54, 35, 52, 62, 37, 55, 34, 25, 45, 28, 26, 45, 66, 47, 59, 62, 43, 55, 123, 74, 57, 106, 58, 55, 121, 73, 63, 121, 62, 58, 131, 84, 76, 122, 68, 64, 121, 62, 58, 38, 36, 54, 26, 29, 41, 50, 32, 47, 25, 21, 37, 68, 42, 44, 49, 35, 51, 120, 68, 58, 115, 72, 70, 118, 69, 63, 118, 69, 63, 80, 62, 55, 48, 37, 46, 66, 47, 59, 106, 58, 55, 133, 74, 63, 111, 66, 66, 105, 71, 74, 51, 39, 39, 41, 23, 39, 44, 32, 43, 34, 42, 43, 51, 32, 37, 26, 29, 41, 68, 42, 44, 66, 42, 47, 121, 73, 63, 123, 79, 62, 123, 74, 57, 111, 66, 66, 122, 68, 64, 123, 84, 79, 135, 76, 63, 126, 91, 82, 49, 40, 50, 48, 37, 46, 52, 40, 55, 53, 51, 48, 121, 75, 66, 121, 62, 58, 106, 58, 55, 125, 72, 62, 81, 47, 53, 51, 45, 45, 66, 42, 55, 121, 77, 69, 116, 60, 57, 115, 72, 70, 135, 88, 79, 109, 70, 59, 121, 73, 63, 22, 36, 58, 35, 25, 40, 66, 47, 59, 120, 68, 58, 45, 43, 58, 62, 41, 48, 57, 45, 59, 122, 68, 55, 116, 60, 57, 106, 58, 55, 106, 58, 55, 108, 79, 76, 129, 87, 66, 87, 49, 60, 76, 55, 54, 49, 44, 53, 43, 45, 64, 43, 45, 64, 108, 79, 76, 121, 75, 66, 118, 69, 63, 129, 76, 68, 94, 59, 52, 184, 125, 101, 178, 129, 101, 184, 134, 108, 178, 129, 101, 182, 124, 99, 177, 126, 106, 178, 136, 114, 127, 145, 170, 178, 136, 114, 179, 127, 106, 184, 128, 105, 182, 134, 112, 182, 129, 104, 178, 129, 101, 184, 128, 105, 178, 129, 101, 184, 134, 108, 179, 133, 101, 184, 134, 108, 185, 121, 101, 184, 132, 106, 177, 122, 98, 182, 129, 104, 178, 129, 101, 140, 144, 167, 177, 130, 112, 178, 126, 103, 180, 125, 100, 182, 126, 106, 179, 127, 106, 184, 136, 114, 184, 132, 106, 174, 80, 66, 182, 76, 47, 177, 71, 50, 176, 78, 51, 179, 76, 52, 180, 85, 66, 177, 126, 101, 132, 146, 170, 118, 68, 64, 182, 82, 49, 182, 76, 56, 181, 76, 51, 179, 69, 49, 182, 76, 56, 181, 82, 59, 180, 72, 49, 182, 76, 47, 177, 71, 50, 175, 74, 51, 177, 76, 58, 177, 76, 58, 175, 67, 47, 176, 78, 51, 182, 124, 99, 132, 151, 167, 121, 74, 68, 179, 73, 58, 175, 67, 47, 175, 74, 51, 176, 86, 69, 175, 73, 58, 177, 76, 58, 182, 66, 51, 180, 72, 49, 177, 84, 52, 176, 72, 55, 174, 80, 66, 175, 67, 47, 178, 129, 101, 137, 151, 173, 118, 76, 76, 179, 69, 49, 182, 86, 54, 176, 78, 51, 174, 80, 66, 179, 73, 58, 176, 72, 55, 181, 85, 62, 181, 71, 51, 177, 84, 52, 176, 72, 55, 177, 76, 57, 175, 67, 47, 181, 85, 62, 182, 76, 47, 178, 126, 103, 127, 145, 170, 118, 63, 58, 182, 76, 56, 182, 66, 51, 179, 76, 52, 182, 82, 49, 181, 87, 69, 175, 74, 51, 181, 77, 59, 185, 87, 68, 186, 78, 52, 178, 82, 68, 179, 75, 60, 185, 87, 68, 187, 132, 104, 133, 148, 173, 112, 63, 65, 181, 77, 59, 182, 73, 56, 187, 84, 50, 179, 69, 49, 179, 69, 49, 185, 74, 50, 184, 71, 50, 180, 80, 52, 182, 86, 53, 179, 69, 49, 186, 83, 57, 178, 82, 68, 184, 75, 60, 184, 71, 50, 182, 130, 104, 141, 148, 171, 123, 69, 62, 179, 76, 52, 186, 84, 61, 178, 82, 68, 180, 80, 52, 187, 67, 52, 182, 86, 53, 190, 80, 54, 191, 80, 59, 191, 80, 59, 184, 71, 50, 186, 79, 60, 189, 73, 52, 192, 135, 106, 148, 148, 176, 119, 64, 62, 191, 80, 50, 190, 89, 65, 190, 80, 54, 188, 84, 66, 187, 75, 53, 184, 71, 50, 186, 79, 60, 189, 89, 70, 186, 79, 61, 191, 86, 52, 190, 80, 54, 189, 76, 52, 189, 89, 70, 191, 69, 54, 191, 132, 104, 136, 161, 183, 111, 66, 71, 184, 71, 50, 189, 77, 61, 187, 75, 57, 191, 69, 54, 190, 86, 62, 184, 71, 50, 195, 70, 55, 190, 90, 56, 195, 93, 58, 193, 83, 59, 192, 81, 56, 192, 78, 62, 196, 138, 108, 139, 164, 187, 126, 71, 66, 193, 91, 71, 193, 91, 71, 187, 79, 55, 187, 78, 62, 194, 87, 60, 195, 82, 51, 194, 76, 55, 189, 81, 62, 191, 86, 67, 188, 93, 74, 191, 86, 67, 188, 84, 55, 187, 78, 62, 194, 91, 66, 198, 145, 110, 137, 152, 178, 127, 73, 68, 195, 82, 61, 189, 81, 62, 192, 78, 62, 194, 94, 74, 189, 81, 62, 187, 79, 55, 120, 76, 67, 118, 71, 66, 119, 86, 86, 134, 74, 72, 133, 67, 66, 132, 74, 66, 202, 141, 108, 155, 168, 185, 134, 74, 72, 133, 84, 77, 132, 74, 66, 133, 84, 77, 115, 77, 83, 122, 72, 74, 129, 69, 74, 129, 73, 68, 117, 63, 63, 130, 83, 83, 133, 84, 77, 117, 63, 63, 135, 86, 70, 129, 73, 68, 126, 78, 79, 194, 143, 123, 154, 167, 188, 134, 74, 63, 133, 67, 66, 130, 83, 83, 130, 83, 83, 130, 83, 83, 120, 76, 67, 130, 83, 83, 104, 118, 146, 114, 105, 138, 112, 120, 144, 109, 116, 141, 101, 110, 138, 96, 111, 141, 100, 121, 139, 149, 157, 183, 109, 116, 141, 100, 121, 139, 100, 121, 139, 108, 114, 139, 110, 115, 139, 108, 111, 137, 108, 111, 137, 93, 107, 136, 99, 114, 143, 107, 111, 143, 114, 119, 138, 112, 125, 150, 97, 116, 139, 107, 111, 143, 113, 115, 136, 101, 110, 138, 151, 159, 187, 104, 118, 146, 99, 114, 143, 112, 123, 145, 114, 119, 138, 114, 119, 138, 104, 118, 146, 99, 114, 143, 200, 147, 123, 203, 145, 109, 200, 136, 109, 200, 138, 116, 196, 138, 113, 200, 138, 109, 200, 138, 116, 202, 141, 115, 201, 141, 111, 195, 134, 108, 202, 141, 108, 203, 133, 111, 140, 159, 187, 196, 142, 111, 202, 141, 108, 200, 138, 109, 196, 149, 125, 195, 134, 108, 198, 137, 114, 202, 147, 119, 203, 149, 113, 196, 142, 111, 197, 140, 116, 200, 138, 116, 201, 141, 111, 195, 138, 116, 203, 133, 111, 200, 141, 111, 155, 165, 183, 202, 145, 117, 196, 138, 113, 194, 143, 123, 200, 90, 54, 192, 74, 52, 197, 83, 57, 193, 95, 76, 199, 90, 65, 198, 79, 54, 192, 80, 64, 193, 95, 76, 198, 93, 73, 200, 95, 59, 194, 83, 64, 194, 143, 123, 154, 168, 191, 120, 76, 67, 193, 95, 76, 195, 78, 55, 195, 78, 60, 191, 88, 73, 191, 88, 73, 198, 79, 54, 193, 95, 76, 200, 95, 59, 198, 85, 60, 192, 74, 52, 193, 86, 56, 193, 95, 76, 195, 78, 60, 200, 141, 111, 143, 159, 185, 120, 68, 70, 197, 83, 57, 195, 78, 60, 199, 96, 76, 199, 93, 68, 197, 76, 54, 199, 96, 76, 192, 80, 64, 199, 78, 56, 195, 92, 57, 193, 86, 56, 194, 83, 64, 193, 79, 60, 200, 90, 54, 195, 138, 116, 154, 167, 188, 124, 67, 65, 199, 93, 68, 196, 88, 69, 198, 85, 60, 195, 78, 60, 193, 95, 76, 197, 83, 57, 200, 72, 56, 200, 95, 59, 192, 80, 64, 195, 78, 60, 195, 78, 60, 200, 95, 59, 193, 86, 56, 202, 145, 117, 155, 161, 182, 130, 83, 83, 194, 83, 64, 192, 80, 64, 195, 92, 57, 200, 72, 56, 200, 72, 56, 197, 83, 57, 192, 81, 56, 200, 95, 59, 196, 88, 69, 192, 74, 52, 200, 90, 54, 199, 90, 65, 199, 78, 56, 202, 137, 111, 154, 165, 187, 133, 87, 85, 197, 76, 54, 199, 89, 61, 199, 90, 65, 195, 78, 60, 195, 78, 60, 193, 79, 60, 200, 84, 52, 200, 95, 59, 197, 83, 57, 193, 95, 76, 193, 95, 76, 200, 84, 62, 193, 86, 56, 199, 143, 120, 151, 159, 183, 120, 68, 70, 199, 84, 56, 193, 79, 60, 194, 83, 63, 192, 80, 64, 200, 72, 56, 198, 93, 73, 194, 83, 63, 199, 84, 56, 197, 83, 57, 192, 81, 56, 199, 84, 56, 195, 78, 55, 193, 86, 56, 202, 149, 125, 154, 165, 187, 129, 69, 74, 194, 83, 64, 197, 80, 64, 199, 84, 56, 195, 78, 60, 200, 90, 54, 193, 86, 56, 198, 79, 54, 196, 88, 69, 199, 96, 76, 197, 76, 54, 192, 74, 52, 196, 88, 69, 199, 96, 76, 202, 137, 111, 151, 161, 184, 133, 81, 75, 198, 93, 73, 198, 85, 60, 200, 95, 59, 194, 83, 63, 200, 84, 52, 198, 93, 73, 200, 72, 56, 199, 89, 61, 195, 78, 60, 198, 85, 60, 196, 88, 69, 199, 84, 56, 193, 79, 60, 202, 141, 108, 140, 156, 182, 134, 74, 72, 192, 81, 56, 196, 88, 69, 199, 78, 56, 200, 84, 62, 196, 88, 69, 199, 78, 56, 199, 89, 61, 192, 74, 52, 200, 90, 54, 193, 79, 60, 194, 83, 64, 193, 79, 60, 195, 78, 60, 200, 138, 116, 146, 158, 185, 133, 79, 71, 192, 81, 56, 199, 93, 68, 133, 81, 75, 134, 74, 72, 134, 74, 63, 135, 86, 70, 115, 77, 83, 135, 80, 65, 123, 67, 71, 117, 63, 63, 117, 63, 63, 133, 67, 66, 133, 81, 75, 197, 146, 111, 145, 161, 187, 133, 79, 71, 133, 81, 75, 119, 86, 86, 130, 69, 64, 115, 77, 83, 134, 74, 72, 122, 72, 74, 135, 80, 65, 135, 86, 70, 133, 79, 71, 132, 74, 66, 134, 74, 63, 118, 71, 66, 134, 74, 63, 197, 146, 111, 151, 161, 184, 128, 65, 64, 135, 80, 65, 115, 77, 83, 113, 115, 142, 114, 124, 140, 112, 119, 141, 107, 111, 143, 113, 115, 136, 92, 111, 143, 97, 116, 139, 114, 119, 138, 100, 110, 141, 109, 116, 141, 112, 120, 144, 95, 124, 151, 139, 163, 190, 91, 118, 149, 112, 123, 145, 97, 116, 139, 107, 111, 143, 100, 121, 139, 95, 124, 151, 93, 107, 136, 93, 107, 136, 106, 108, 137, 113, 115, 136, 104, 118, 146, 108, 114, 139, 108, 122, 149, 110, 115, 139, 99, 114, 143, 146, 158, 183, 91, 118, 149, 112, 119, 141, 97, 116, 139, 203, 133, 111, 200, 138, 116, 154, 167, 188, 202, 147, 119, 200, 138, 116, 199, 143, 120, 200, 142, 114, 199, 143, 120, 199, 143, 120, 203, 145, 109, 200, 138, 116, 200, 138, 109, 202, 141, 115, 196, 142, 111, 195, 134, 108, 202, 141, 108, 195, 134, 108, 203, 145, 109, 151, 159, 183, 202, 141, 115, 200, 147, 123, 202, 137, 111, 202, 147, 119, 197, 140, 116, 200, 138, 116, 197, 140, 116, 195, 139, 111, 200, 147, 123, 196, 142, 111, 197, 140, 116, 202, 137, 111, 198, 137, 114, 199, 78, 56, 195, 138, 116, 154, 158, 184, 116, 69, 74, 192, 74, 52, 192, 81, 56, 200, 90, 54, 194, 83, 64, 192, 80, 64, 193, 95, 76, 192, 81, 56, 192, 74, 52, 197, 80, 64, 199, 90, 65, 195, 92, 57, 197, 76, 54, 193, 86, 56, 195, 134, 108, 145, 161, 187, 122, 72, 74, 192, 81, 56, 195, 78, 55, 200, 84, 52, 198, 79, 54, 199, 90, 65, 200, 84, 62, 197, 76, 54, 199, 84, 56, 200, 84, 62, 200, 90, 54, 198, 85, 60, 194, 83, 63, 192, 80, 64, 200, 136, 109, 145, 161, 187, 133, 67, 66, 200, 84, 52, 196, 88, 69, 200, 95, 59, 192, 81, 56, 199, 96, 76, 200, 90, 54, 197, 83, 57, 200, 72, 56, 200, 84, 62, 198, 79, 54, 192, 80, 64, 193, 79, 60, 200, 84, 52, 202, 147, 119, 140, 156, 182, 122, 72, 74, 193, 79, 60, 195, 92, 57, 199, 78, 56, 199, 93, 68, 193, 79, 60, 197, 80, 64, 191, 88, 73, 193, 86, 56, 200, 95, 59, 197, 76, 54, 198, 93, 73, 198, 93, 73, 193, 79, 60, 202, 141, 108, 148, 164, 188, 115, 77, 83, 200, 84, 52, 200, 84, 62, 200, 90, 54, 195, 92, 57, 200, 72, 56, 193, 86, 56, 191, 88, 73, 199, 90, 65, 192, 81, 56, 199, 84, 56, 198, 79, 54, 192, 81, 56, 197, 76, 54, 200, 138, 116, 139, 163, 190, 133, 79, 71, 192, 74, 52, 195, 92, 57, 193, 86, 56, 197, 76, 54, 198, 79, 54, 192, 74, 52, 192, 74, 52, 200, 90, 54, 195, 78, 60, 194, 83, 63, 193, 79, 60, 193, 79, 60, 200, 90, 54, 195, 138, 116, 151, 159, 187, 126, 78, 79, 199, 78, 56, 195, 78, 60, 200, 90, 54, 192, 74, 52, 199, 90, 65, 200, 72, 56, 195, 78, 60, 197, 80, 64, 192, 74, 52, 192, 80, 64, 193, 95, 76, 198, 79, 54, 200, 72, 56, 200, 147, 123, 151, 159, 183, 132, 74, 66, 200, 90, 54, 194, 83, 64, 198, 93, 73, 194, 83, 63, 192, 74, 52, 195, 78, 55, 196, 88, 69, 199, 84, 56, 199, 93, 68, 200, 84, 52, 195, 78, 55, 200, 72, 56, 198, 79, 54, 200, 142, 114, 151, 162, 185, 118, 71, 66, 195, 78, 55, 198, 79, 54, 198, 85, 60, 192, 81, 56, 194, 83, 64, 199, 96, 76, 197, 80, 64, 194, 83, 64, 200, 84, 62, 198, 85, 60, 192, 74, 52, 200, 95, 59, 199, 93, 68, 195, 138, 116, 143, 163, 184, 126, 78, 79, 193, 95, 76, 196, 88, 69, 194, 83, 64, 199, 78, 56, 200, 84, 52, 199, 89, 61, 192, 80, 64, 192, 81, 56, 198, 93, 73, 198, 93, 73, 197, 83, 57, 193, 95, 76, 134, 74, 72, 197, 140, 116, 145, 161, 187, 126, 78, 79, 135, 80, 65, 119, 86, 86, 126, 78, 79, 130, 83, 83, 120, 76, 67, 130, 83, 83, 130, 83, 83, 130, 83, 83, 133, 67, 66, 134, 74, 63, 133, 84, 77, 115, 77, 83, 126, 78, 79, 129, 73, 68, 155, 168, 185, 117, 63, 63, 133, 84, 77, 130, 83, 83, 117, 63, 63, 129, 73, 68, 129, 69, 74, 122, 72, 74, 115, 77, 83, 133, 84, 77, 132, 74, 66, 133, 84, 77, 134, 74, 72, 135, 86, 70, 112, 123, 145, 114, 119, 138, 154, 164, 186, 93, 107, 136, 112, 120, 144, 92, 111, 143, 94, 113, 138, 99, 114, 143, 104, 118, 146, 114, 119, 138, 114, 119, 138, 112, 123, 145, 99, 114, 143, 104, 118, 146, 107, 111, 143, 101, 110, 138, 113, 115, 136, 107, 111, 143, 143, 163, 184, 112, 125, 150, 114, 119, 138, 107, 111, 143, 99, 114, 143, 93, 107, 136, 108, 111, 137, 108, 111, 137, 110, 115, 139, 108, 114, 139, 100, 121, 139, 100, 121, 139, 109, 116, 141, 106, 108, 137, 197, 146, 111, 201, 141, 111, 194, 143, 123, 196, 142, 111, 197, 140, 116, 203, 133, 111, 202, 145, 117, 194, 143, 123, 196, 138, 113, 202, 145, 117, 155, 165, 183, 200, 141, 111, 203, 133, 111, 195, 138, 116, 201, 141, 111, 200, 138, 116, 197, 140, 116, 196, 142, 111, 203, 149, 113, 202, 147, 119, 198, 137, 114, 195, 134, 108, 196, 149, 125, 200, 138, 109, 202, 141, 108, 196, 142, 111, 140, 159, 187, 203, 133, 111, 202, 141, 108, 195, 134, 108, 201, 141, 111, 202, 141, 115, 194, 91, 66, 194, 91, 66, 189, 81, 62, 191, 86, 67, 188, 84, 55, 187, 86, 71, 194, 82, 55, 190, 76, 59, 192, 81, 56, 191, 135, 110, 140, 155, 181, 126, 71, 66, 190, 76, 59, 188, 93, 74, 188, 84, 55, 187, 72, 51, 193, 83, 59, 195, 93, 58, 188, 93, 74, 193, 77, 53, 187, 86, 71, 187, 86, 71, 190, 76, 59, 190, 76, 54, 188, 93, 74, 191, 139, 108, 150, 164, 187, 112, 75, 81, 189, 81, 62, 195, 93, 58, 193, 91, 71, 188, 93, 74, 184, 71, 50, 185, 82, 54, 189, 81, 57, 190, 75, 54, 191, 86, 52, 184, 77, 61, 190, 75, 54, 184, 77, 61, 186, 79, 61, 191, 141, 118, 148, 154, 174, 127, 78, 72, 185, 82, 54, 191, 91, 56, 187, 75, 57, 187, 75, 57, 184, 77, 61, 191, 91, 56, 191, 69, 54, 189, 79, 55, 185, 91, 73, 187, 75, 57, 189, 81, 57, 188, 84, 66, 190, 89, 65, 189, 131, 105, 147, 160, 180, 111, 66, 71, 191, 86, 52, 185, 76, 57, 186, 79, 61, 185, 82, 54, 186, 84, 61, 183, 82, 64, 180, 80, 52, 186, 78, 52, 186, 78, 52, 180, 89, 71, 185, 87, 68, 180, 74, 56, 186, 78, 52, 183, 129, 105, 141, 148, 171, 118, 73, 74, 180, 80, 52, 187, 78, 58, 180, 89, 71, 180, 89, 71, 184, 77, 53, 187, 89, 55, 187, 78, 49, 180, 74, 56, 182, 73, 56, 182, 73, 56, 186, 84, 61, 186, 83, 57, 184, 71, 50, 189, 139, 117, 144, 154, 175, 124, 63, 62, 186, 73, 52, 186, 84, 61, 187, 84, 50, 179, 69, 49, 175, 67, 47, 177, 84, 52, 181, 81, 55, 179, 69, 49, 175, 73, 58, 182, 66, 51, 177, 84, 52, 180, 77, 55, 180, 85, 66, 184, 132, 106, 137, 146, 167, 121, 61, 60, 181, 87, 69, 178, 80, 63, 175, 67, 47, 179, 69, 49, 181, 87, 69, 178, 80, 63, 180, 72, 49, 176, 78, 51, 182, 82, 49, 177, 71, 55, 181, 76, 51, 179, 73, 58, 177, 76, 58, 182, 126, 106, 140, 150, 170, 121, 79, 77, 176, 78, 51, 177, 71, 50, 181, 76, 51, 175, 74, 51, 179, 76, 52, 175, 67, 47, 176, 86, 69, 177, 71, 55, 180, 72, 49, 182, 82, 49, 176, 86, 69, 181, 85, 62, 175, 74, 51, 184, 131, 104, 133, 144, 168, 117, 63, 67, 177, 71, 55, 176, 72, 55, 177, 76, 58, 176, 72, 55, 182, 82, 49, 175, 67, 47, 181, 81, 55, 181, 71, 51, 178, 80, 63, 182, 76, 56, 181, 71, 51, 178, 80, 63, 175, 74, 51, 184, 128, 105, 127, 142, 166, 122, 67, 57, 176, 72, 55, 181, 76, 51, 178, 80, 63, 180, 77, 55, 118, 68, 64, 112, 75, 62, 121, 72, 65, 111, 66, 67, 106, 57, 57, 116, 59, 58, 111, 66, 67, 105, 70, 76, 123, 73, 59, 182, 124, 99, 137, 146, 167, 112, 75, 62, 122, 67, 57, 107, 65, 60, 122, 67, 57, 120, 67, 60, 121, 72, 65, 123, 78, 64, 123, 73, 59, 111, 66, 67, 122, 67, 66, 105, 70, 76, 118, 63, 58, 108, 78, 78, 121, 74, 68, 184, 131, 104, 132, 146, 170, 112, 75, 62, 121, 74, 68, 121, 61, 60, 106, 57, 57, 106, 57, 57, 92, 100, 126, 104, 113, 127, 91, 100, 128, 102, 112, 132, 96, 98, 125, 95, 107, 133, 98, 111, 136, 88, 106, 126, 102, 108, 128, 83, 107, 136, 133, 144, 166, 90, 104, 130, 100, 105, 126, 98, 111, 136, 98, 104, 126, 95, 107, 133, 103, 105, 124, 96, 98, 125, 85, 97, 124, 85, 97, 124, 86, 113, 137, 91, 110, 126, 97, 101, 130, 88, 106, 126, 102, 112, 132, 83, 107, 136, 126, 148, 173, 86, 113, 137, 102, 109, 131, 99, 106, 128, 91, 100, 128, 104, 108, 126, 140, 144, 166, 130, 148, 166, 140, 152, 170, 130, 148, 166, 136, 143, 166, 98, 117, 146, 159, 177, 194, 127, 145, 169, 146, 166, 184, 148, 161, 181, 156, 161, 180, 137, 151, 172, 137, 147, 167, 102, 121, 142, 155, 158, 177, 102, 121, 142, 140, 152, 170, 132, 151, 166, 140, 152, 170, 141, 141, 166, 140, 150, 169, 113, 126, 151, 112, 121, 144, 160, 174, 189, 140, 144, 166, 126, 148, 172, 130, 145, 167, 133, 144, 166, 137, 145, 169, 104, 119, 146, 167, 177, 193, 140, 150, 169, 97, 122, 150, 116, 120, 140, 133, 144, 166, 130, 148, 166, 111, 119, 143, 152, 162, 180, 128, 146, 166, 148, 161, 181, 137, 147, 167, 141, 150, 166, 141, 146, 168, 139, 146, 166, 109, 115, 141, 155, 158, 177, 182, 189, 203, 151, 156, 175, 116, 120, 140, 133, 144, 166, 128, 146, 166, 132, 146, 169, 117, 131, 156, 99, 114, 140, 160, 174, 189, 164, 171, 188, 105, 125, 143, 115, 124, 146, 137, 145, 169, 127, 142, 165, 100, 118, 142, 145, 163, 181, 127, 145, 169, 148, 161, 181, 173, 174, 194, 155, 161, 179, 107, 128, 147, 105, 119, 147, 146, 163, 185, 162, 175, 193, 105, 124, 146, 141, 155, 176, 141, 155, 176, 139, 147, 170, 145, 157, 172, 105, 124, 146, 146, 163, 185, 185, 191, 208, 181, 191, 207, 187, 195, 208, 158, 160, 179, 107, 128, 147, 133, 148, 172, 120, 134, 160, 102, 117, 144, 172, 181, 197, 172, 178, 193, 148, 160, 181, 162, 176, 196, 155, 161, 179, 119, 123, 148, 119, 115, 146, 155, 161, 180, 172, 180, 193, 118, 132, 155, 132, 149, 171, 139, 154, 178, 174, 186, 203, 190, 197, 211, 184, 198, 214, 166, 181, 201, 174, 186, 203, 159, 166, 185, 107, 122, 151, 107, 122, 151, 109, 125, 153, 110, 122, 151, 163, 168, 184, 134, 149, 173, 134, 149, 173, 144, 152, 174, 143, 150, 174, 186, 198, 211, 154, 170, 185, 104, 120, 147, 121, 129, 151, 166, 184, 203, 189, 196, 213, 143, 150, 174, 135, 153, 175, 144, 152, 174, 175, 183, 199, 185, 197, 211, 191, 199, 213, 166, 184, 203, 168, 183, 199, 163, 161, 184, 110, 131, 150, 194, 201, 216, 137, 142, 166, 180, 187, 204, 188, 199, 216, 190, 201, 218, 193, 199, 216, 194, 201, 216, 181, 182, 203, 174, 184, 203, 180, 187, 202, 180, 189, 206, 149, 157, 179, 192, 203, 219, 228, 225, 221, 188, 199, 216, 159, 173, 194, 147, 162, 185, 190, 201, 218, 166, 172, 187, 164, 170, 187, 178, 185, 202, 147, 162, 185, 230, 224, 221, 194, 200, 216, 189, 205, 220, 120, 139, 167, 170, 183, 202, 193, 200, 218, 191, 200, 217, 196, 198, 216, 195, 203, 218, 170, 183, 202, 172, 172, 196, 163, 181, 197, 141, 152, 169, 182, 191, 209, 181, 190, 208, 151, 159, 186, 153, 161, 183, 142, 168, 190, 198, 206, 222, 199, 209, 224, 151, 166, 189, 193, 206, 221, 159, 176, 199, 170, 180, 198, 171, 177, 195, 170, 175, 196, 145, 161, 186, 136, 150, 175, 175, 195, 213, 197, 208, 224, 143, 163, 183, 233, 230, 227, 171, 182, 200, 172, 183, 197, 159, 173, 195, 168, 178, 198, 140, 145, 170, 177, 190, 210, 181, 189, 210, 154, 168, 190, 145, 161, 186, 141, 160, 183, 161, 178, 196, 160, 176, 196, 142, 168, 190, 184, 191, 209, 154, 158, 183, 236, 231, 226, 201, 206, 221, 201, 210, 222, 155, 161, 185, 200, 209, 223, 141, 147, 169, 154, 167, 187, 158, 179, 201, 145, 161, 186, 151, 159, 186, 151, 161, 183, 140, 156, 181, 123, 138, 165, 200, 209, 223, 140, 156, 181, 201, 210, 222, 168, 177, 197, 165, 179, 200, 158, 179, 201, 171, 182, 200, 171, 177, 195, 154, 158, 183, 182, 194, 212, 151, 166, 189, 235, 232, 229, 194, 207, 221, 199, 209, 224, 148, 164, 187, 155, 155, 183, 139, 149, 172, 182, 191, 209, 146, 158, 182, 194, 205, 222, 163, 181, 197, 167, 174, 196, 168, 178, 198, 145, 166, 183, 195, 209, 222, 139, 147, 170, 153, 161, 183, 151, 159, 182, 151, 159, 182, 140, 156, 181, 145, 161, 186, 122, 129, 160, 201, 208, 221, 154, 168, 190, 143, 163, 183, 168, 176, 199, 155, 161, 181, 146, 158, 182, 151, 159, 186, 148, 164, 187, 129, 144, 171, 184, 194, 211, 155, 165, 182, 201, 208, 221, 165, 179, 200, 163, 177, 199, 151, 166, 189, 155, 165, 182, 134, 140, 167, 181, 189, 210, 143, 159, 184, 199, 205, 221, 168, 176, 199, 171, 177, 198, 170, 177, 196, 140, 156, 181, 144, 147, 168, 185, 186, 208, 127, 145, 173, 143, 163, 183, 155, 161, 181, 151, 159, 182, 111, 140, 166, 174, 187, 207, 196, 205, 222, 126, 139, 162, 155, 168, 184, 143, 163, 183, 145, 161, 186, 168, 176, 199, 153, 161, 183, 140, 159, 186, 141, 137, 167, 181, 190, 208, 155, 165, 182, 200, 208, 223, 161, 175, 197, 158, 179, 201, 155, 165, 182, 124, 138, 166, 122, 131, 157, 175, 195, 213, 154, 165, 186, 199, 205, 221, 159, 176, 199, 142, 168, 190, 168, 181, 201, 155, 168, 184, 145, 161, 186, 126, 150, 177, 184, 195, 212, 112, 133, 156, 111, 140, 166, 116, 128, 155, 178, 188, 209, 192, 207, 224, 173, 192, 212, 166, 172, 192, 111, 140, 166, 155, 168, 184, 151, 162, 184, 140, 156, 181, 143, 163, 183, 125, 152, 176, 115, 127, 158, 181, 190, 208, 143, 159, 184, 194, 205, 222, 168, 177, 197, 146, 158, 185, 126, 141, 166, 126, 139, 162, 165, 170, 192, 184, 195, 212, 140, 159, 186, 200, 205, 221, 145, 166, 183, 143, 163, 183, 145, 161, 186, 143, 159, 184, 155, 165, 182, 127, 145, 173, 169, 178, 196, 178, 188, 208, 184, 194, 211, 179, 192, 211, 151, 162, 184, 146, 158, 185, 142, 168, 190, 181, 190, 208, 170, 168, 192, 128, 140, 158, 108, 129, 160, 115, 127, 158, 115, 127, 158, 128, 140, 158, 159, 175, 193, 184, 193, 210, 155, 161, 181, 199, 209, 224, 145, 161, 186, 140, 159, 186, 161, 178, 193, 170, 168, 192, 185, 186, 208, 181, 190, 208, 125, 143, 167, 155, 168, 184, 165, 179, 200, 140, 156, 181, 155, 165, 182, 154, 165, 186, 139, 141, 167, 126, 128, 156, 169, 177, 195, 200, 210, 225, 149, 157, 182, 154, 164, 185, 236, 232, 228, 196, 205, 222, 164, 175, 198, 143, 159, 184, 184, 191, 207, 170, 179, 194, 166, 173, 193, 159, 179, 199, 159, 179, 199, 170, 174, 194, 176, 191, 208, 179, 192, 211, 136, 142, 166, 143, 159, 184, 170, 177, 196, 143, 159, 184, 195, 206, 223, 193, 205, 223, 201, 203, 221, 182, 194, 212, 114, 131, 160, 138, 145, 167, 151, 161, 183, 141, 160, 183, 138, 145, 167, 130, 141, 167, 127, 146, 168, 126, 141, 166, 169, 177, 195, 151, 159, 186, 195, 206, 223, 235, 230, 227, 170, 177, 196, 164, 175, 198, 172, 180, 196, 161, 178, 196, 151, 159, 182, 197, 208, 224, 200, 210, 225, 198, 204, 221, 193, 204, 221, 197, 208, 224, 200, 210, 225, 183, 188, 208, 122, 131, 157, 139, 149, 172, 151, 166, 189, 151, 162, 184, 155, 168, 184, 145, 161, 186, 140, 145, 166, 199, 209, 224, 185, 186, 208, 126, 135, 158, 115, 127, 158, 123, 133, 158, 118, 134, 162, 125, 132, 156, 112, 128, 158, 170, 174, 191, 157, 169, 191, 155, 161, 185, 160, 176, 196, 165, 179, 200, 170, 175, 196, 171, 177, 198, 148, 164, 187, 154, 158, 183, 139, 148, 170, 193, 204, 221, 155, 165, 182, 143, 159, 184, 145, 161, 186, 143, 159, 184, 130, 141, 170, 198, 205, 223, 178, 188, 209, 126, 135, 158, 110, 130, 156, 126, 139, 162, 236, 232, 228, 201, 206, 222, 155, 161, 181, 141, 152, 169, 192, 207, 224, 184, 193, 207, 178, 188, 209, 157, 169, 191, 157, 169, 191, 169, 171, 192, 184, 193, 210, 195, 209, 222, 177, 190, 210, 126, 135, 158, 154, 165, 186, 160, 183, 202, 151, 159, 182, 139, 163, 189, 155, 161, 185, 129, 144, 171, 128, 136, 155, 155, 168, 184, 236, 231, 227, 199, 206, 221, 236, 231, 226, 193, 206, 221, 155, 161, 181, 129, 150, 168, 198, 206, 222, 180, 188, 207, 184, 193, 207, 156, 175, 198, 171, 177, 198, 172, 183, 197, 170, 180, 198, 151, 159, 186, 184, 191, 207, 193, 205, 223, 143, 163, 183, 155, 165, 182, 146, 158, 185, 151, 162, 184, 154, 165, 186, 142, 168, 190, 139, 163, 189, 173, 192, 212, 126, 139, 162, 143, 163, 183, 151, 159, 186, 145, 166, 183, 125, 152, 176, 109, 125, 154, 157, 169, 191, 149, 157, 182, 201, 206, 221, 165, 179, 200, 168, 177, 197, 168, 181, 201, 170, 177, 196, 145, 161, 186, 178, 188, 208, 192, 207, 224, 154, 164, 185, 143, 163, 183, 172, 172, 196, 168, 176, 199, 171, 182, 200, 154, 167, 187, 181, 189, 210, 148, 164, 187, 235, 231, 227, 235, 231, 228, 197, 208, 224, 201, 208, 221, 198, 205, 223, 182, 189, 207, 184, 191, 209, 143, 163, 183, 174, 187, 207, 127, 132, 154, 109, 125, 154, 128, 136, 155, 123, 128, 155, 170, 174, 194, 151, 166, 189, 170, 175, 196, 171, 182, 200, 163, 177, 199, 168, 176, 199, 163, 177, 199, 160, 176, 196, 151, 166, 189, 176, 191, 208, 145, 161, 186, 236, 230, 226, 234, 230, 227, 154, 158, 183, 140, 159, 186, 154, 158, 183, 123, 142, 171, 174, 187, 207, 141, 160, 183, 201, 208, 221, 163, 177, 199, 159, 176, 199, 160, 183, 202, 160, 176, 196, 140, 156, 181, 151, 159, 186, 139, 149, 172, 195, 209, 222, 198, 204, 221, 176, 191, 208, 174, 187, 207, 177, 190, 210, 195, 206, 223, 141, 160, 183, 164, 175, 196, 171, 177, 195, 168, 175, 196, 154, 165, 186, 155, 161, 185, 149, 157, 182, 138, 145, 167, 184, 191, 209, 155, 165, 182, 199, 207, 222, 163, 177, 199, 140, 159, 186, 167, 174, 196, 129, 144, 171, 126, 128, 156, 184, 191, 207, 148, 164, 187, 172, 183, 197, 160, 176, 196, 171, 183, 202, 155, 165, 182, 151, 161, 183, 155, 155, 183, 140, 145, 170, 123, 128, 155, 174, 189, 210, 176, 189, 209, 155, 161, 181, 154, 167, 187, 140, 156, 181, 177, 190, 210, 112, 128, 158, 145, 166, 183, 154, 158, 183, 171, 182, 200, 143, 159, 184, 168, 176, 199, 122, 147, 175, 112, 133, 156, 185, 195, 209, 149, 157, 182, 168, 181, 201, 168, 181, 201, 126, 141, 169, 140, 145, 166, 118, 134, 162, 156, 175, 198, 201, 206, 221, 127, 132, 159, 155, 165, 182, 145, 166, 183, 155, 155, 183, 143, 163, 183, 122, 147, 175, 126, 136, 161, 110, 130, 156, 168, 174, 192, 199, 205, 221, 141, 160, 183, 235, 230, 226, 198, 205, 223, 192, 207, 224, 154, 164, 185, 174, 187, 207, 115, 137, 157, 143, 163, 183, 134, 140, 167, 136, 142, 166, 124, 138, 166, 109, 125, 154, 170, 176, 192, 196, 205, 222, 114, 131, 160, 143, 159, 184, 143, 159, 184, 128, 136, 155, 108, 129, 160, 166, 172, 195, 197, 208, 224, 200, 205, 221, 162, 171, 194, 128, 136, 155, 109, 125, 154, 126, 136, 161, 128, 123, 156, 115, 127, 158, 166, 172, 195, 157, 169, 191, 174, 189, 210, 142, 168, 190, 199, 205, 221, 172, 172, 196, 168, 181, 201, 168, 175, 196, 170, 177, 196, 141, 148, 167, 177, 190, 210, 123, 138, 165, 114, 131, 160, 109, 125, 154, 116, 128, 155, 164, 175, 196, 199, 206, 221, 200, 209, 223, 170, 174, 191, 116, 128, 155, 128, 123, 156, 166, 172, 192, 167, 174, 194, 151, 162, 184, 141, 160, 183, 146, 158, 182, 151, 159, 182, 182, 191, 209, 158, 172, 192, 161, 173, 195, 169, 180, 199, 166, 172, 195, 177, 190, 210, 184, 191, 209, 182, 191, 209, 140, 156, 181, 201, 210, 222, 171, 182, 200, 159, 176, 199, 161, 178, 196, 165, 179, 200, 142, 168, 190, 132, 147, 173, 161, 173, 195, 169, 171, 192, 170, 174, 191, 169, 176, 194, 140, 159, 186, 141, 160, 183, 151, 166, 189, 151, 166, 189, 181, 190, 208, 159, 179, 199, 155, 161, 185, 195, 206, 223, 234, 231, 227, 197, 208, 224, 172, 180, 196, 142, 168, 190, 148, 164, 187, 182, 194, 212, 176, 191, 208, 151, 166, 189, 151, 166, 189, 151, 166, 189, 154, 158, 183, 184, 191, 207, 126, 139, 162, 139, 163, 189, 165, 179, 200, 151, 161, 183, 155, 168, 184, 140, 156, 181, 154, 167, 187, 151, 166, 189, 140, 156, 181, 198, 206, 222, 151, 159, 186, 195, 206, 223, 233, 231, 229, 200, 209, 223, 170, 177, 196, 154, 167, 187, 155, 161, 185, 185, 195, 209, 171, 182, 200, 172, 180, 196, 170, 180, 198, 159, 173, 195, 170, 180, 199, 159, 176, 199, 110, 130, 156, 195, 206, 223, 148, 164, 187, 236, 232, 226, 201, 208, 221, 200, 209, 223, 163, 177, 199, 148, 164, 187, 198, 205, 223, 116, 128, 155, 155, 161, 181, 151, 159, 186, 143, 163, 183, 154, 168, 190, 172, 180, 196, 168, 176, 199, 129, 144, 171, 193, 204, 221, 168, 175, 196, 168, 175, 196, 170, 177, 196, 168, 177, 197, 163, 181, 197, 163, 181, 197, 123, 133, 158, 198, 204, 221, 145, 166, 183, 153, 161, 183, 139, 163, 189, 143, 163, 183, 145, 161, 186, 128, 123, 156, 184, 193, 210, 139, 163, 189, 161, 175, 197, 170, 180, 199, 172, 180, 196, 151, 161, 183, 155, 155, 183, 108, 129, 160, 168, 174, 192, 122, 129, 160, 145, 161, 186, 143, 163, 183, 155, 168, 184, 154, 167, 187, 146, 158, 185, 124, 138, 166, 111, 140, 166, 182, 189, 207, 155, 161, 181, 143, 163, 183, 140, 159, 186, 155, 155, 183, 155, 161, 181, 109, 125, 154, 183, 191, 208, 155, 161, 185, 126, 139, 162, 126, 139, 162, 145, 161, 186, 148, 164, 187, 112, 133, 156, 156, 175, 198, 153, 161, 183, 164, 175, 198, 151, 161, 183, 143, 159, 184, 143, 159, 184, 151, 161, 183, 115, 127, 158, 159, 179, 199, 194, 207, 221, 157, 169, 191, 123, 133, 158, 155, 168, 184, 142, 168, 190, 151, 159, 182, 122, 147, 175, 107, 134, 165, 178, 188, 209, 178, 188, 208, 111, 140, 166, 112, 133, 156, 154, 168, 190, 139, 163, 189, 114, 131, 160, 170, 179, 194, 151, 166, 189, 160, 183, 202, 170, 183, 202, 155, 171, 188, 120, 130, 154, 123, 125, 152, 166, 172, 187, 170, 185, 205, 123, 125, 152, 137, 155, 182, 142, 157, 182, 147, 162, 185, 151, 157, 177, 123, 133, 157, 155, 171, 188, 196, 205, 217, 191, 200, 217, 191, 200, 217, 153, 168, 190, 125, 137, 154, 151, 151, 179, 133, 141, 164, 108, 137, 162, 174, 184, 204, 178, 187, 204, 160, 171, 191, 180, 189, 206, 158, 167, 187, 123, 136, 158, 105, 126, 156, 166, 172, 187, 172, 185, 204, 111, 128, 156, 140, 159, 179, 147, 158, 178, 171, 184, 202, 186, 198, 211, 190, 197, 211, 175, 183, 199, 167, 187, 204, 160, 170, 189, 107, 122, 151, 120, 126, 149, 107, 122, 151, 118, 122, 148, 157, 167, 188, 137, 156, 175, 148, 154, 177, 136, 161, 182, 136, 161, 182, 189, 197, 212, 163, 171, 186, 122, 126, 147, 107, 122, 151, 170, 180, 200, 188, 196, 212, 147, 158, 178, 147, 157, 177, 143, 150, 174, 176, 187, 203, 191, 199, 213, 191, 196, 211, 175, 180, 199, 176, 185, 201, 163, 168, 184, 104, 120, 147, 180, 190, 206, 120, 140, 157, 171, 179, 195, 185, 190, 206, 180, 191, 208, 188, 189, 206, 182, 195, 207, 170, 178, 195, 170, 181, 198, 172, 180, 196, 169, 177, 194, 144, 147, 171, 187, 196, 210, 219, 216, 213, 180, 190, 206, 156, 162, 183, 144, 157, 177, 184, 194, 209, 155, 161, 179, 148, 163, 180, 172, 180, 193, 136, 147, 173, 220, 216, 211, 185, 191, 208, 182, 192, 208, 126, 133, 160, 172, 180, 196, 187, 196, 210, 181, 193, 206, 183, 191, 206, 186, 192, 206, 163, 177, 194, 153, 161, 179, 145, 157, 177, 114, 138, 160, 162, 171, 190, 166, 172, 188, 141, 150, 166, 129, 153, 173, 140, 152, 170, 176, 187, 201, 182, 189, 202, 133, 144, 168, 180, 187, 203, 149, 159, 180, 146, 159, 179, 148, 161, 181, 146, 159, 179, 141, 150, 166, 116, 128, 153, 166, 175, 190, 182, 187, 201, 135, 149, 170, 215, 210, 207, 155, 159, 178, 150, 163, 182, 146, 160, 178, 156, 161, 180, 113, 126, 151, 167, 174, 188, 160, 172, 190, 139, 146, 166, 135, 149, 170, 137, 147, 167, 153, 162, 180, 148, 165, 179, 140, 149, 168, 161, 173, 191, 127, 142, 165, 214, 209, 206, 177, 187, 203, 175, 188, 204, 141, 150, 166, 180, 186, 201, 126, 134, 155, 132, 151, 166, 156, 161, 177, 128, 146, 166, 141, 146, 165, 139, 146, 166, 140, 149, 168, 116, 127, 144, 183, 189, 201, 132, 146, 169, 183, 187, 202, 144, 163, 183, 153, 159, 178, 146, 166, 184, 155, 164, 181, 155, 164, 180, 132, 146, 169, 162, 177, 189, 140, 150, 169, 215, 209, 206, 176, 186, 201, 176, 186, 201, 133, 144, 166, 141, 153, 167, 118, 128, 155, 167, 177, 192, 136, 143, 166, 179, 189, 204, 153, 165, 183, 146, 162, 178, 155, 164, 180, 126, 148, 172, 178, 187, 201, 120, 134, 157, 139, 146, 166, 137, 151, 172, 137, 146, 166, 135, 149, 170, 141, 146, 165, 109, 115, 141, 176, 186, 201, 127, 142, 165, 129, 153, 173, 148, 165, 179, 137, 145, 169, 130, 148, 166, 140, 152, 170, 126, 148, 172, 111, 134, 159, 159, 177, 194, 140, 150, 169, 181, 188, 202, 149, 159, 180, 156, 164, 178, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 162, 162, 162, 147, 147, 147, 155, 155, 155, 139, 139, 139, 154, 154, 154, 170, 170, 170, 170, 170, 170, 148, 148, 148, 174, 174, 174, 154, 154, 154, 155, 155, 155, 155, 155, 155, 147, 147, 147, 94, 94, 94, 94, 94, 94, 162, 162, 162, 147, 147, 147, 153, 153, 153, 139, 139, 139, 172, 172, 172, 160, 160, 160, 147, 147, 147, 146, 146, 146, 153, 153, 153, 162, 162, 162, 149, 149, 149, 157, 157, 157, 166, 166, 166, 94, 94, 94, 94, 94, 94, 96, 96, 96, 96, 96, 96, 163, 163, 163, 159, 159, 159, 150, 150, 150, 175, 175, 175, 161, 161, 161, 151, 151, 151, 151, 151, 151, 157, 157, 157, 152, 152, 152, 171, 171, 171, 143, 143, 143, 143, 143, 143, 157, 157, 157, 96, 96, 96, 96, 96, 96, 166, 166, 166, 143, 143, 143, 170, 170, 170, 159, 159, 159, 159, 159, 159, 152, 152, 152, 151, 151, 151, 157, 157, 157, 163, 163, 163, 151, 151, 151, 173, 173, 173, 159, 159, 159, 158, 158, 158, 96, 96, 96, 96, 96, 96, 99, 99, 99, 99, 99, 99, 170, 170, 170, 146, 146, 146, 99, 99, 99, 99, 99, 99, 167, 167, 167, 157, 157, 157, 156, 156, 156, 168, 168, 168, 181, 181, 181, 167, 167, 167, 169, 169, 169, 156, 156, 156, 146, 146, 146, 99, 99, 99, 99, 99, 99, 161, 161, 161, 175, 175, 175, 167, 167, 167, 161, 161, 161, 179, 179, 179, 157, 157, 157, 161, 161, 161, 174, 174, 174, 154, 154, 154, 99, 99, 99, 99, 99, 99, 156, 156, 156, 157, 157, 157, 99, 99, 99, 99, 99, 99, 101, 101, 101, 101, 101, 101, 187, 187, 187, 172, 172, 172, 101, 101, 101, 101, 101, 101, 171, 171, 171, 178, 178, 178, 169, 169, 169, 183, 183, 183, 183, 183, 183, 158, 158, 158, 157, 157, 157, 178, 178, 178, 172, 172, 172, 101, 101, 101, 101, 101, 101, 173, 173, 173, 178, 178, 178, 173, 173, 173, 165, 165, 165, 157, 157, 157, 185, 185, 185, 187, 187, 187, 149, 149, 149, 172, 172, 172, 101, 101, 101, 101, 101, 101, 166, 166, 166, 189, 189, 189, 101, 101, 101, 101, 101, 101, 103, 103, 103, 103, 103, 103, 182, 182, 182, 178, 178, 178, 170, 170, 170, 175, 175, 175, 176, 176, 176, 191, 191, 191, 178, 178, 178, 189, 189, 189, 175, 175, 175, 189, 189, 189, 170, 170, 170, 168, 168, 168, 170, 170, 170, 103, 103, 103, 103, 103, 103, 187, 187, 187, 189, 189, 189, 153, 153, 153, 191, 191, 191, 173, 173, 173, 177, 177, 177, 170, 170, 170, 189, 189, 189, 176, 176, 176, 170, 170, 170, 187, 187, 187, 187, 187, 187, 187, 187, 187, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 185, 185, 185, 176, 176, 176, 163, 163, 163, 162, 162, 162, 178, 178, 178, 163, 163, 163, 176, 176, 176, 178, 178, 178, 178, 178, 178, 173, 173, 173, 175, 175, 175, 168, 168, 168, 168, 168, 168, 103, 103, 103, 103, 103, 103, 170, 170, 170, 183, 183, 183, 194, 194, 194, 169, 169, 169, 170, 170, 170, 176, 176, 176, 163, 163, 163, 170, 170, 170, 177, 177, 177, 168, 168, 168, 189, 189, 189, 183, 183, 183, 183, 183, 183, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 163, 163, 163, 170, 170, 170, 162, 162, 162, 168, 168, 168, 170, 170, 170, 178, 178, 178, 175, 175, 175, 153, 153, 153, 176, 176, 176, 164, 164, 164, 161, 161, 161, 169, 169, 169, 176, 176, 176, 103, 103, 103, 103, 103, 103, 153, 153, 153, 163, 163, 163, 189, 189, 189, 191, 191, 191, 169, 169, 169, 168, 168, 168, 170, 170, 170, 175, 175, 175, 161, 161, 161, 164, 164, 164, 173, 173, 173, 183, 183, 183, 185, 185, 185, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 173, 173, 173, 182, 182, 182, 185, 185, 185, 168, 168, 168, 161, 161, 161, 182, 182, 182, 187, 187, 187, 191, 191, 191, 168, 168, 168, 170, 170, 170, 194, 194, 194, 169, 169, 169, 182, 182, 182, 103, 103, 103, 103, 103, 103, 170, 170, 170, 170, 170, 170, 168, 168, 168, 182, 182, 182, 191, 191, 191, 176, 176, 176, 153, 153, 153, 169, 169, 169, 182, 182, 182, 163, 163, 163, 173, 173, 173, 162, 162, 162, 162, 162, 162, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 163, 163, 163, 194, 194, 194, 161, 161, 161, 170, 170, 170, 178, 178, 178, 169, 169, 169, 168, 168, 168, 162, 162, 162, 183, 183, 183, 161, 161, 161, 189, 189, 189, 163, 163, 163, 189, 189, 189, 103, 103, 103, 103, 103, 103, 163, 163, 163, 182, 182, 182, 173, 173, 173, 164, 164, 164, 191, 191, 191, 161, 161, 161, 163, 163, 163, 163, 163, 163, 191, 191, 191, 169, 169, 169, 185, 185, 185, 176, 176, 176, 187, 187, 187, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 164, 164, 164, 173, 173, 173, 162, 162, 162, 191, 191, 191, 177, 177, 177, 153, 153, 153, 183, 183, 183, 185, 185, 185, 170, 170, 170, 170, 170, 170, 185, 185, 185, 194, 194, 194, 163, 163, 163, 103, 103, 103, 103, 103, 103, 163, 163, 163, 163, 163, 163, 162, 162, 162, 176, 176, 176, 191, 191, 191, 173, 173, 173, 182, 182, 182, 182, 182, 182, 178, 178, 178, 169, 169, 169, 177, 177, 177, 168, 168, 168, 162, 162, 162, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 164, 164, 164, 187, 187, 187, 168, 168, 168, 175, 175, 175, 173, 173, 173, 162, 162, 162, 175, 175, 175, 163, 163, 163, 169, 169, 169, 194, 194, 194, 185, 185, 185, 170, 170, 170, 168, 168, 168, 103, 103, 103, 103, 103, 103, 163, 163, 163, 183, 183, 183, 169, 169, 169, 168, 168, 168, 177, 177, 177, 194, 194, 194, 163, 163, 163, 153, 153, 153, 177, 177, 177, 194, 194, 194, 170, 170, 170, 173, 173, 173, 185, 185, 185, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 176, 176, 176, 187, 187, 187, 164, 164, 164, 182, 182, 182, 163, 163, 163, 176, 176, 176, 177, 177, 177, 175, 175, 175, 162, 162, 162, 176, 176, 176, 153, 153, 153, 178, 178, 178, 162, 162, 162, 103, 103, 103, 103, 103, 103, 178, 178, 178, 177, 177, 177, 170, 170, 170, 182, 182, 182, 153, 153, 153, 183, 183, 183, 162, 162, 162, 168, 168, 168, 162, 162, 162, 163, 163, 163, 170, 170, 170, 163, 163, 163, 182, 182, 182, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 176, 176, 176, 191, 191, 191, 170, 170, 170, 183, 183, 183, 163, 163, 163, 153, 153, 153, 153, 153, 153, 170, 170, 170, 185, 185, 185, 178, 178, 178, 168, 168, 168, 182, 182, 182, 185, 185, 185, 103, 103, 103, 103, 103, 103, 170, 170, 170, 178, 178, 178, 168, 168, 168, 183, 183, 183, 191, 191, 191, 182, 182, 182, 175, 175, 175, 176, 176, 176, 162, 162, 162, 176, 176, 176, 178, 178, 178, 173, 173, 173, 163, 163, 163, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 182, 182, 182, 170, 170, 170, 176, 176, 176, 161, 161, 161, 169, 169, 169, 183, 183, 183, 163, 163, 163, 176, 176, 176, 185, 185, 185, 182, 182, 182, 170, 170, 170, 170, 170, 170, 189, 189, 189, 103, 103, 103, 103, 103, 103, 178, 178, 178, 182, 182, 182, 153, 153, 153, 153, 153, 153, 163, 163, 163, 176, 176, 176, 177, 177, 177, 173, 173, 173, 187, 187, 187, 175, 175, 175, 168, 168, 168, 163, 163, 163, 170, 170, 170, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 189, 189, 189, 189, 189, 189, 170, 170, 170, 177, 177, 177, 176, 176, 176, 177, 177, 177, 177, 177, 177, 183, 183, 183, 170, 170, 170, 103, 103, 103, 103, 103, 103, 169, 169, 169, 153, 153, 153, 103, 103, 103, 103, 103, 103, 183, 183, 183, 168, 168, 168, 103, 103, 103, 103, 103, 103, 170, 170, 170, 189, 189, 189, 168, 168, 168, 170, 170, 170, 168, 168, 168, 162, 162, 162, 187, 187, 187, 169, 169, 169, 168, 168, 168, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 170, 170, 170, 161, 161, 161, 153, 153, 153, 162, 162, 162, 183, 183, 183, 168, 168, 168, 161, 161, 161, 182, 182, 182, 162, 162, 162, 103, 103, 103, 103, 103, 103, 185, 185, 185, 178, 178, 178, 103, 103, 103, 103, 103, 103, 153, 153, 153, 168, 168, 168, 103, 103, 103, 103, 103, 103, 163, 163, 163, 176, 176, 176, 168, 168, 168, 185, 185, 185, 178, 178, 178, 163, 163, 163, 175, 175, 175, 178, 178, 178, 183, 183, 183, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 168, 168, 168, 170, 170, 170, 176, 176, 176, 177, 177, 177, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 168, 168, 168, 161, 161, 161, 103, 103, 103, 103, 103, 103, 189, 189, 189, 153, 153, 153, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 170, 170, 170, 169, 169, 169, 191, 191, 191, 163, 163, 163, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 177, 177, 177, 170, 170, 170, 176, 176, 176, 178, 178, 178, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 175, 175, 175, 168, 168, 168, 103, 103, 103, 103, 103, 103, 170, 170, 170, 170, 170, 170, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 153, 153, 153, 183, 183, 183, 163, 163, 163, 168, 168, 168, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 170, 170, 170, 177, 177, 177, 170, 170, 170, 163, 163, 163, 183, 183, 183, 153, 153, 153, 185, 185, 185, 164, 164, 164, 163, 163, 163, 170, 170, 170, 153, 153, 153, 161, 161, 161, 182, 182, 182, 103, 103, 103, 103, 103, 103, 187, 187, 187, 168, 168, 168, 175, 175, 175, 183, 183, 183, 168, 168, 168, 187, 187, 187, 168, 168, 168, 153, 153, 153, 163, 163, 163, 177, 177, 177, 175, 175, 175, 189, 189, 189, 176, 176, 176, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 176, 176, 176, 162, 162, 162, 163, 163, 163, 168, 168, 168, 176, 176, 176, 162, 162, 162, 168, 168, 168, 194, 194, 194, 170, 170, 170, 168, 168, 168, 178, 178, 178, 176, 176, 176, 153, 153, 153, 103, 103, 103, 103, 103, 103, 161, 161, 161, 169, 169, 169, 177, 177, 177, 182, 182, 182, 177, 177, 177, 168, 168, 168, 170, 170, 170, 176, 176, 176, 182, 182, 182, 161, 161, 161, 162, 162, 162, 187, 187, 187, 187, 187, 187, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 168, 168, 168, 177, 177, 177, 183, 183, 183, 182, 182, 182, 177, 177, 177, 187, 187, 187, 169, 169, 169, 187, 187, 187, 187, 187, 187, 187, 187, 187, 170, 170, 170, 176, 176, 176, 189, 189, 189, 103, 103, 103, 103, 103, 103, 173, 173, 173, 191, 191, 191, 153, 153, 153, 189, 189, 189, 187, 187, 187, 153, 153, 153, 173, 173, 173, 170, 170, 170, 168, 168, 168, 170, 170, 170, 189, 189, 189, 175, 175, 175, 189, 189, 189, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 182, 182, 182, 153, 153, 153, 185, 185, 185, 161, 161, 161, 162, 162, 162, 168, 168, 168, 177, 177, 177, 183, 183, 183, 183, 183, 183, 189, 189, 189, 168, 168, 168, 177, 177, 177, 170, 170, 170, 103, 103, 103, 103, 103, 103, 170, 170, 170, 169, 169, 169, 194, 194, 194, 183, 183, 183, 170, 170, 170, 168, 168, 168, 153, 153, 153, 168, 168, 168, 168, 168, 168, 175, 175, 175, 173, 173, 173, 178, 178, 178, 178, 178, 178, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 170, 170, 170, 169, 169, 169, 168, 168, 168, 164, 164, 164, 185, 185, 185, 170, 170, 170, 162, 162, 162, 185, 185, 185, 183, 183, 183, 173, 173, 173, 164, 164, 164, 161, 161, 161, 175, 175, 175, 103, 103, 103, 103, 103, 103, 169, 169, 169, 191, 191, 191, 189, 189, 189, 163, 163, 163, 153, 153, 153, 182, 182, 182, 168, 168, 168, 176, 176, 176, 169, 169, 169, 161, 161, 161, 164, 164, 164, 176, 176, 176, 153, 153, 153, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 168, 168, 168, 177, 177, 177, 169, 169, 169, 170, 170, 170, 175, 175, 175, 163, 163, 163, 173, 173, 173, 162, 162, 162, 162, 162, 162, 173, 173, 173, 163, 163, 163, 182, 182, 182, 169, 169, 169, 103, 103, 103, 103, 103, 103, 191, 191, 191, 182, 182, 182, 168, 168, 168, 170, 170, 170, 170, 170, 170, 163, 163, 163, 163, 163, 163, 182, 182, 182, 169, 169, 169, 194, 194, 194, 170, 170, 170, 168, 168, 168, 191, 191, 191, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 176, 176, 176, 170, 170, 170, 183, 183, 183, 161, 161, 161, 170, 170, 170, 161, 161, 161, 168, 168, 168, 187, 187, 187, 176, 176, 176, 185, 185, 185, 169, 169, 169, 191, 191, 191, 163, 163, 163, 103, 103, 103, 103, 103, 103, 191, 191, 191, 164, 164, 164, 173, 173, 173, 182, 182, 182, 163, 163, 163, 176, 176, 176, 177, 177, 177, 189, 189, 189, 163, 163, 163, 189, 189, 189, 161, 161, 161, 183, 183, 183, 162, 162, 162, 103, 103, 103, 103, 103, 103, 101, 101, 101, 101, 101, 101, 165, 165, 165, 171, 171, 171, 171, 171, 171, 178, 178, 178, 183, 183, 183, 158, 158, 158, 171, 171, 171, 158, 158, 158, 164, 164, 164, 173, 173, 173, 165, 165, 165, 174, 174, 174, 178, 178, 178, 101, 101, 101, 101, 101, 101, 187, 187, 187, 172, 172, 172, 158, 158, 158, 159, 159, 159, 159, 159, 159, 181, 181, 181, 178, 178, 178, 159, 159, 159, 189, 189, 189, 181, 181, 181, 166, 166, 166, 166, 166, 166, 181, 181, 181, 101, 101, 101, 101, 101, 101, 210, 188, 0, 210, 188, 0, 86, 86, 86, 86, 86, 86, 86, 86, 86, 210, 188, 0, 210, 188, 0, 210, 188, 0, 86, 86, 86, 86, 86, 86, 86, 86, 86, 210, 188, 0, 210, 188, 0, 210, 188, 0, 86, 86, 86, 86, 86, 86, 86, 86, 86, 210, 188, 0, 210, 188, 0, 210, 188, 0, 86, 86, 86, 86, 86, 86, 86, 86, 86, 210, 188, 0, 210, 188, 0, 210, 188, 0, 86, 86, 86, 86, 86, 86, 86, 86, 86, 210, 188, 0, 210, 188, 0, 210, 188, 0, 204, 183, 0, 84, 84, 84, 84, 84, 84, 84, 84, 84, 204, 183, 0, 204, 183, 0, 204, 183, 0, 84, 84, 84, 84, 84, 84, 84, 84, 84, 204, 183, 0, 204, 183, 0, 204, 183, 0, 84, 84, 84, 84, 84, 84, 84, 84, 84, 204, 183, 0, 204, 183, 0, 204, 183, 0, 84, 84, 84, 84, 84, 84, 84, 84, 84, 204, 183, 0, 204, 183, 0, 204, 183, 0, 84, 84, 84, 84, 84, 84, 84, 84, 84, 204, 183, 0, 204, 183, 0, 204, 183, 0, 84, 84, 84, 82, 82, 82, 82, 82, 82, 82, 82, 82, 199, 178, 0, 199, 178, 0, 199, 178, 0, 82, 82, 82, 82, 82, 82, 82, 82, 82, 199, 178, 0, 199, 178, 0, 199, 178, 0, 82, 82, 82, 82, 82, 82, 82, 82, 82, 199, 178, 0, 199, 178, 0, 199, 178, 0, 82, 82, 82, 82, 82, 82, 82, 82, 82, 199, 178, 0, 199, 178, 0, 199, 178, 0, 82, 82, 82, 82, 82, 82, 82, 82, 82, 199, 178, 0, 199, 178, 0, 199, 178, 0, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 199, 178, 0, 199, 178, 0, 199, 178, 0, 82, 82, 82, 82, 82, 82, 82, 82, 82, 199, 178, 0, 199, 178, 0, 199, 178, 0, 82, 82, 82, 82, 82, 82, 82, 82, 82, 199, 178, 0, 199, 178, 0, 199, 178, 0, 82, 82, 82, 82, 82, 82, 82, 82, 82, 199, 178, 0, 199, 178, 0, 199, 178, 0, 82, 82, 82, 82, 82, 82, 82, 82, 82, 199, 178, 0, 199, 178, 0, 199, 178, 0, 82, 82, 82, 82, 82, 82, 82, 82, 82, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 255, 255, 255, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 2, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 2, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 232, 183, 150, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 228, 166, 114, 194, 133, 105, 228, 166, 114, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 215, 118, 67, 228, 166, 114, 215, 118, 67, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 232, 183, 150, 215, 118, 67, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 232, 183, 150, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 232, 183, 150, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 215, 118, 67, 215, 118, 67, 228, 166, 114, 194, 133, 105, 194, 133, 105, 232, 183, 150, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 215, 118, 67, 215, 118, 67, 215, 118, 67, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 228, 166, 114, 232, 183, 150, 228, 166, 114, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 232, 183, 150, 232, 183, 150, 194, 133, 105, 228, 166, 114, 215, 118, 67, 215, 118, 67, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 232, 183, 150, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 215, 118, 67, 215, 118, 67, 215, 118, 67, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 228, 166, 114, 232, 183, 150, 228, 166, 114, 228, 166, 114, 194, 133, 105, 228, 166, 114, 232, 183, 150, 228, 166, 114, 194, 133, 105, 194, 133, 105, 184, 111, 80, 194, 133, 105, 232, 183, 150, 232, 183, 150, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 215, 118, 67, 194, 133, 105, 194, 133, 105, 194, 133, 105, 215, 118, 67, 228, 166, 114, 228, 166, 114, 194, 133, 105, 232, 183, 150, 232, 183, 150, 194, 133, 105, 194, 133, 105, 194, 133, 105, 232, 183, 150, 194, 133, 105, 228, 166, 114, 194, 133, 105, 228, 166, 114, 228, 166, 114, 194, 133, 105, 184, 111, 80, 194, 133, 105, 184, 111, 80, 194, 133, 105, 228, 166, 114, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 215, 118, 67, 215, 118, 67, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 194, 133, 105, 232, 183, 150, 232, 183, 150, 232, 183, 150, 194, 133, 105, 194, 133, 105, 228, 166, 114, 232, 183, 150, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 194, 133, 105, 228, 166, 114, 194, 133, 105, 232, 183, 150, 228, 166, 114, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 232, 183, 150, 232, 183, 150, 232, 183, 150, 194, 133, 105, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 228, 166, 114, 232, 183, 150, 232, 183, 150, 215, 118, 67, 228, 166, 114, 194, 133, 105, 228, 166, 114, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 184, 111, 80, 194, 133, 105, 184, 111, 80, 194, 133, 105, 228, 166, 114, 194, 133, 105, 228, 166, 114, 228, 166, 114, 232, 183, 150, 184, 111, 80, 215, 118, 67, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 228, 166, 114, 228, 166, 114, 232, 183, 150, 232, 183, 150, 232, 183, 150, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 215, 118, 67, 228, 166, 114, 228, 166, 114, 184, 111, 80, 184, 111, 80, 194, 133, 105, 228, 166, 114, 215, 118, 67, 215, 118, 67, 228, 166, 114, 194, 133, 105, 232, 183, 150, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 215, 118, 67, 215, 118, 67, 215, 118, 67, 228, 166, 114, 228, 166, 114, 184, 111, 80, 184, 111, 80, 184, 111, 80, 215, 118, 67, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 228, 166, 114, 194, 133, 105, 232, 183, 150, 228, 166, 114, 232, 183, 150, 228, 166, 114, 184, 111, 80, 194, 133, 105, 215, 118, 67, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 215, 118, 67, 215, 118, 67, 184, 111, 80, 184, 111, 80, 184, 111, 80, 215, 118, 67, 184, 111, 80, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 228, 166, 114, 215, 118, 67, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 215, 118, 67, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 215, 118, 67, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 184, 111, 80, 232, 183, 150, 184, 111, 80, 184, 111, 80, 194, 133, 105, 184, 111, 80, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 228, 166, 114, 194, 133, 105, 184, 111, 80, 232, 183, 150, 184, 111, 80, 184, 111, 80, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 232, 183, 150, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 184, 111, 80, 184, 111, 80, 194, 133, 105, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 232, 183, 150, 228, 166, 114, 228, 166, 114, 184, 111, 80, 184, 111, 80, 228, 166, 114, 194, 133, 105, 184, 111, 80, 194, 133, 105, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 232, 183, 150, 194, 133, 105, 228, 166, 114, 228, 166, 114, 228, 166, 114, 232, 183, 150, 215, 118, 67, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 228, 166, 114, 228, 166, 114, 215, 118, 67, 228, 166, 114, 194, 133, 105, 194, 133, 105, 184, 111, 80, 194, 133, 105, 228, 166, 114, 184, 111, 80, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 232, 183, 150, 228, 166, 114, 194, 133, 105, 228, 166, 114, 228, 166, 114, 228, 166, 114, 232, 183, 150, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 228, 166, 114, 228, 166, 114, 228, 166, 114, 215, 118, 67, 228, 166, 114, 194, 133, 105, 194, 133, 105, 184, 111, 80, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 232, 183, 150, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 215, 118, 67, 194, 133, 105, 194, 133, 105, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 194, 133, 105, 184, 111, 80, 184, 111, 80, 194, 133, 105, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 215, 118, 67, 215, 118, 67, 215, 118, 67, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 194, 133, 105, 194, 133, 105, 184, 111, 80, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 215, 118, 67, 215, 118, 67, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 184, 111, 80, 194, 133, 105, 232, 183, 150, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 184, 111, 80, 194, 133, 105, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 184, 111, 80, 232, 183, 150, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 194, 133, 105, 184, 111, 80, 184, 111, 80, 194, 133, 105, 184, 111, 80, 184, 111, 80, 228, 166, 114, 228, 166, 114, 228, 166, 114, 228, 166, 114, 228, 166, 114, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 232, 183, 150, 194, 133, 105, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 184, 111, 80, 194, 133, 105, 184, 111, 80, 184, 111, 80, 232, 183, 150, 184, 111, 80, 194, 133, 105, 194, 133, 105, 232, 183, 150, 194, 133, 105, 194, 133, 105, 228, 166, 114, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 228, 166, 114, 194, 133, 105, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 194, 133, 105, 194, 133, 105, 215, 118, 67, 215, 118, 67, 194, 133, 105, 184, 111, 80, 232, 183, 150, 232, 183, 150, 194, 133, 105, 194, 133, 105, 232, 183, 150, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 232, 183, 150, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 184, 111, 80, 184, 111, 80, 232, 183, 150, 194, 133, 105, 194, 133, 105, 232, 183, 150, 228, 166, 114, 215, 118, 67, 215, 118, 67, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 232, 183, 150, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 228, 166, 114, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 184, 111, 80, 215, 118, 67, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 184, 111, 80, 215, 118, 67, 228, 166, 114, 228, 166, 114, 228, 166, 114, 184, 111, 80, 184, 111, 80, 228, 166, 114, 194, 133, 105, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 228, 166, 114, 228, 166, 114, 228, 166, 114, 228, 166, 114, 228, 166, 114, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 215, 118, 67, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 215, 118, 67, 215, 118, 67, 228, 166, 114, 228, 166, 114, 228, 166, 114, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 194, 133, 105, 194, 133, 105, 215, 118, 67, 194, 133, 105, 228, 166, 114, 194, 133, 105, 194, 133, 105, 215, 118, 67, 228, 166, 114, 232, 183, 150, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 228, 166, 114, 215, 118, 67, 215, 118, 67, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 194, 133, 105, 184, 111, 80, 215, 118, 67, 228, 166, 114, 215, 118, 67, 215, 118, 67, 215, 118, 67, 215, 118, 67, 215, 118, 67, 194, 133, 105, 215, 118, 67, 228, 166, 114, 228, 166, 114, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 194, 133, 105, 228, 166, 114, 215, 118, 67, 184, 111, 80, 184, 111, 80, 232, 183, 150, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 228, 166, 114, 228, 166, 114, 228, 166, 114, 194, 133, 105, 228, 166, 114, 215, 118, 67, 215, 118, 67, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 215, 118, 67, 184, 111, 80, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 228, 166, 114, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 215, 118, 67, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 228, 166, 114, 194, 133, 105, 194, 133, 105, 228, 166, 114, 194, 133, 105, 194, 133, 105, 228, 166, 114, 194, 133, 105, 228, 166, 114, 215, 118, 67, 194, 133, 105, 194, 133, 105, 194, 133, 105, 184, 111, 80, 184, 111, 80, 184, 111, 80, 232, 183, 150, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 194, 133, 105, 228, 166, 114, 184, 111, 80, 184, 111, 80, 184, 111, 80, 232, 183, 150, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 194, 133, 105, 228, 166, 114, 228, 166, 114, 228, 166, 114, 228, 166, 114, 228, 166, 114, 215, 118, 67, 228, 166, 114, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 194, 133, 105, 228, 166, 114, 228, 166, 114, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 184, 111, 80, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 38, 111, 93, 21, 76, 89, 21, 76, 89, 27, 90, 91, 21, 76, 89, 21, 76, 89, 38, 111, 93, 21, 76, 89, 21, 76, 89, 27, 90, 91, 27, 90, 91, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 21, 76, 89, 21, 76, 89, 27, 90, 91, 21, 76, 89, 21, 76, 89, 21, 76, 89, 38, 111, 93, 21, 76, 89, 27, 90, 91, 21, 76, 89, 38, 111, 93, 21, 76, 89, 21, 76, 89, 27, 90, 91, 21, 76, 89, 21, 76, 89, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 27, 90, 91, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 21, 76, 89, 21, 76, 89, 38, 111, 93, 21, 76, 89, 27, 90, 91, 21, 76, 89, 38, 111, 93, 21, 76, 89, 21, 76, 89, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 38, 111, 93, 21, 76, 89, 38, 111, 93, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 21, 76, 89, 38, 111, 93, 21, 76, 89, 38, 111, 93, 38, 111, 93, 38, 111, 93, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 38, 111, 93, 55, 139, 96, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 27, 90, 91, 27, 90, 91, 21, 76, 89, 21, 76, 89, 38, 111, 93, 21, 76, 89, 27, 90, 91, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 55, 139, 96, 38, 111, 93, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 21, 76, 89, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 38, 111, 93, 55, 139, 96, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 55, 139, 96, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 38, 111, 93, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 38, 111, 93, 27, 90, 91, 21, 76, 89, 27, 90, 91, 21, 76, 89, 21, 76, 89, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 55, 139, 96, 38, 111, 93, 27, 90, 91, 38, 111, 93, 21, 76, 89, 55, 139, 96, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 55, 139, 96, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 55, 139, 96, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 21, 76, 89, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 55, 139, 96, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 27, 90, 91, 38, 111, 93, 38, 111, 93, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 38, 111, 93, 27, 90, 91, 21, 76, 89, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 55, 139, 96, 38, 111, 93, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 38, 111, 93, 21, 76, 89, 21, 76, 89, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 55, 139, 96, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 52, 141, 97, 27, 90, 91, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 38, 111, 93, 55, 139, 96, 55, 139, 96, 38, 111, 93, 38, 111, 93, 38, 111, 93, 38, 111, 93, 38, 111, 93, 27, 90, 91, 38, 111, 93, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 55, 139, 96, 38, 111, 93, 38, 111, 93, 38, 111, 93, 27, 90, 91, 55, 139, 96, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 55, 139, 96, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 38, 111, 93, 38, 111, 93, 27, 90, 91, 38, 111, 93, 38, 111, 93, 38, 111, 93, 27, 90, 91, 55, 139, 96, 38, 111, 93, 38, 111, 93, 38, 111, 93, 38, 111, 93, 38, 111, 93, 38, 111, 93, 55, 139, 96, 55, 139, 96, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 55, 139, 96, 21, 76, 89, 21, 76, 89, 38, 111, 93, 38, 111, 93, 21, 76, 89, 27, 90, 91, 38, 111, 93, 38, 111, 93, 55, 139, 96, 38, 111, 93, 38, 111, 93, 27, 90, 91, 38, 111, 93, 27, 90, 91, 38, 111, 93, 38, 111, 93, 38, 111, 93, 27, 90, 91, 38, 111, 93, 38, 111, 93, 38, 111, 93, 38, 111, 93, 38, 111, 93, 55, 139, 96, 27, 90, 91, 27, 90, 91, 55, 139, 96, 38, 111, 93, 38, 111, 93, 27, 90, 91, 55, 139, 96, 21, 76, 89, 21, 76, 89, 21, 76, 89, 38, 111, 93, 21, 76, 89, 27, 90, 91, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 38, 111, 93, 27, 90, 91, 38, 111, 93, 38, 111, 93, 27, 90, 91, 38, 111, 93, 38, 111, 93, 27, 90, 91, 38, 111, 93, 27, 90, 91, 38, 111, 93, 38, 111, 93, 38, 111, 93, 55, 139, 96, 55, 139, 96, 38, 111, 93, 38, 111, 93, 38, 111, 93, 55, 139, 96, 21, 76, 89, 27, 90, 91, 21, 76, 89, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 27, 90, 91, 55, 139, 96, 38, 111, 93, 27, 90, 91, 55, 139, 96, 38, 111, 93, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 55, 139, 96, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 21, 76, 89, 55, 139, 96, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 21, 76, 89, 38, 111, 93, 21, 76, 89, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 55, 139, 96, 55, 139, 96, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 21, 76, 89, 38, 111, 93, 55, 139, 96, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 21, 76, 89, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 38, 111, 93, 21, 76, 89, 21, 76, 89, 27, 90, 91, 55, 139, 96, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 21, 76, 89, 55, 139, 96, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 21, 76, 89, 21, 76, 89, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 21, 76, 89, 21, 76, 89, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 21, 76, 89, 21, 76, 89, 21, 76, 89, 27, 90, 91, 55, 139, 96, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 38, 111, 93, 21, 76, 89, 27, 90, 91, 21, 76, 89, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 27, 90, 91, 21, 76, 89, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 21, 76, 89, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 21, 76, 89, 21, 76, 89, 21, 76, 89, 38, 111, 93, 38, 111, 93, 27, 90, 91, 55, 139, 96, 38, 111, 93, 38, 111, 93, 27, 90, 91, 21, 76, 89, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 27, 90, 91, 27, 90, 91, 21, 76, 89, 55, 139, 96, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 21, 76, 89, 21, 76, 89, 27, 90, 91, 21, 76, 89, 27, 90, 91, 27, 90, 91, 38, 111, 93, 55, 139, 96, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 38, 111, 93, 21, 76, 89, 27, 90, 91, 55, 139, 96, 27, 90, 91, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 55, 139, 96, 27, 90, 91, 21, 76, 89, 38, 111, 93, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 21, 76, 89, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 38, 111, 93, 55, 139, 96, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 21, 76, 89, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 38, 111, 93, 27, 90, 91, 38, 111, 93, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 38, 111, 93, 21, 76, 89, 21, 76, 89, 21, 76, 89, 27, 90, 91, 27, 90, 91, 38, 111, 93, 55, 139, 96, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 21, 76, 89, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 38, 111, 93, 21, 76, 89, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 21, 76, 89, 21, 76, 89, 21, 76, 89, 38, 111, 93, 21, 76, 89, 27, 90, 91, 21, 76, 89, 27, 90, 91, 21, 76, 89, 27, 90, 91, 38, 111, 93, 21, 76, 89, 38, 111, 93, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 21, 76, 89, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 27, 90, 91, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 38, 111, 93, 21, 76, 89, 27, 90, 91, 27, 90, 91, 21, 76, 89, 38, 111, 93, 27, 90, 91, 21, 76, 89, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 21, 76, 89, 21, 76, 89, 21, 76, 89, 27, 90, 91, 21, 76, 89, 27, 90, 91, 38, 111, 93, 21, 76, 89, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 21, 76, 89, 21, 76, 89, 27, 90, 91, 21, 76, 89, 38, 111, 93, 38, 111, 93, 27, 90, 91, 38, 111, 93, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 38, 111, 93, 38, 111, 93, 21, 76, 89, 27, 90, 91, 21, 76, 89, 27, 90, 91, 27, 90, 91, 21, 76, 89, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 27, 90, 91, 21, 76, 89, 38, 111, 93, 21, 76, 89, 21, 76, 89, 38, 111, 93, 38, 111, 93, 21, 76, 89, 21, 76, 89, 27, 90, 91, 21, 76, 89, 27, 90, 91, 21, 76, 89, 38, 111, 93, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 27, 90, 91, 21, 76, 89, 38, 111, 93, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 21, 76, 89, 27, 90, 91, 27, 90, 91, 21, 76, 89, 27, 90, 91, 21, 76, 89, 38, 111, 93, 21, 76, 89, 27, 90, 91, 27, 90, 91, 27, 90, 91, 38, 111, 93, 21, 76, 89, 21, 76, 89, 21, 76, 89, 27, 90, 91, 21, 76, 89, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 27, 90, 91, 21, 76, 89, 21, 76, 89, 38, 111, 93, 21, 76, 89, 27, 90, 91, 21, 76, 89, 27, 90, 91, 38, 111, 93, 21, 76, 89, 27, 90, 91, 21, 76, 89, 21, 76, 89, 27, 90, 91, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 27, 90, 91, 55, 139, 96, 27, 90, 91, 21, 76, 89, 21, 76, 89, 38, 111, 93, 27, 90, 91, 27, 90, 91, 27, 90, 91, 21, 76, 89, 21, 76, 89, 21, 76, 89, 21, 76, 89, 38, 43, 68, 58, 68, 102, 58, 68, 102, 90, 105, 136, 90, 105, 136, 58, 68, 102, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 58, 68, 102, 90, 105, 136, 58, 68, 102, 58, 68, 102, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 38, 43, 68, 38, 43, 68, 90, 105, 136, 90, 105, 136, 62, 39, 49, 90, 105, 136, 62, 39, 49, 90, 105, 136, 90, 105, 136, 58, 68, 102, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 139, 155, 180, 38, 43, 68, 58, 68, 102, 62, 39, 49, 62, 39, 49, 38, 43, 68, 58, 68, 102, 38, 43, 68, 58, 68, 102, 38, 43, 68, 62, 39, 49, 62, 39, 49, 62, 39, 49, 38, 43, 68, 38, 43, 68, 38, 43, 68, 139, 155, 180, 38, 43, 68, 90, 105, 136, 38, 43, 68, 62, 39, 49, 90, 105, 136, 38, 43, 68, 90, 105, 136, 38, 43, 68, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 139, 155, 180, 38, 43, 68, 62, 39, 49, 58, 68, 102, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 62, 39, 49, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 90, 105, 136, 62, 39, 49, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 115, 62, 57, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 90, 105, 136, 38, 43, 68, 62, 39, 49, 62, 39, 49, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 139, 155, 180, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 139, 155, 180, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 90, 105, 136, 90, 105, 136, 38, 43, 68, 62, 39, 49, 62, 39, 49, 38, 43, 68, 90, 105, 136, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 115, 62, 57, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 62, 39, 49, 38, 43, 68, 62, 39, 49, 139, 155, 180, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 139, 155, 180, 139, 155, 180, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 139, 155, 180, 90, 105, 136, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 62, 39, 49, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 139, 155, 180, 38, 43, 68, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 90, 105, 136, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 58, 68, 102, 62, 39, 49, 62, 39, 49, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 139, 155, 180, 38, 43, 68, 62, 39, 49, 90, 105, 136, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 139, 155, 180, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 58, 68, 102, 58, 68, 102, 58, 68, 102, 90, 105, 136, 62, 39, 49, 62, 39, 49, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 139, 155, 180, 38, 43, 68, 38, 43, 68, 62, 39, 49, 38, 43, 68, 58, 68, 102, 58, 68, 102, 38, 43, 68, 38, 43, 68, 90, 105, 136, 58, 68, 102, 38, 43, 68, 115, 62, 57, 90, 105, 136, 38, 43, 68, 58, 68, 102, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 58, 68, 102, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 58, 68, 102, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 58, 68, 102, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 115, 62, 57, 90, 105, 136, 58, 68, 102, 58, 68, 102, 38, 43, 68, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 90, 105, 136, 58, 68, 102, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 90, 105, 136, 38, 43, 68, 58, 68, 102, 90, 105, 136, 58, 68, 102, 58, 68, 102, 38, 43, 68, 62, 39, 49, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 58, 68, 102, 90, 105, 136, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 58, 68, 102, 90, 105, 136, 38, 43, 68, 58, 68, 102, 115, 62, 57, 115, 62, 57, 58, 68, 102, 38, 43, 68, 38, 43, 68, 58, 68, 102, 139, 155, 180, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 139, 155, 180, 38, 43, 68, 38, 43, 68, 139, 155, 180, 58, 68, 102, 58, 68, 102, 90, 105, 136, 62, 39, 49, 115, 62, 57, 58, 68, 102, 58, 68, 102, 58, 68, 102, 38, 43, 68, 58, 68, 102, 58, 68, 102, 38, 43, 68, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 62, 39, 49, 62, 39, 49, 58, 68, 102, 62, 39, 49, 58, 68, 102, 58, 68, 102, 58, 68, 102, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 62, 39, 49, 62, 39, 49, 58, 68, 102, 58, 68, 102, 62, 39, 49, 38, 43, 68, 58, 68, 102, 38, 43, 68, 58, 68, 102, 38, 43, 68, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 139, 155, 180, 90, 105, 136, 58, 68, 102, 58, 68, 102, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 62, 39, 49, 58, 68, 102, 38, 43, 68, 90, 105, 136, 90, 105, 136, 90, 105, 136, 38, 43, 68, 58, 68, 102, 139, 155, 180, 38, 43, 68, 62, 39, 49, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 62, 39, 49, 38, 43, 68, 62, 39, 49, 62, 39, 49, 90, 105, 136, 58, 68, 102, 38, 43, 68, 58, 68, 102, 38, 43, 68, 139, 155, 180, 38, 43, 68, 58, 68, 102, 58, 68, 102, 62, 39, 49, 62, 39, 49, 58, 68, 102, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 62, 39, 49, 38, 43, 68, 90, 105, 136, 139, 155, 180, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 115, 62, 57, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 62, 39, 49, 58, 68, 102, 58, 68, 102, 58, 68, 102, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 90, 105, 136, 38, 43, 68, 62, 39, 49, 38, 43, 68, 58, 68, 102, 38, 43, 68, 62, 39, 49, 62, 39, 49, 62, 39, 49, 38, 43, 68, 90, 105, 136, 58, 68, 102, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 139, 155, 180, 38, 43, 68, 58, 68, 102, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 139, 155, 180, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 62, 39, 49, 38, 43, 68, 58, 68, 102, 38, 43, 68, 62, 39, 49, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 58, 68, 102, 38, 43, 68, 90, 105, 136, 38, 43, 68, 58, 68, 102, 90, 105, 136, 58, 68, 102, 58, 68, 102, 90, 105, 136, 58, 68, 102, 58, 68, 102, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 90, 105, 136, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 58, 68, 102, 38, 43, 68, 62, 39, 49, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 58, 68, 102, 139, 155, 180, 58, 68, 102, 58, 68, 102, 90, 105, 136, 38, 43, 68, 58, 68, 102, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 90, 105, 136, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 58, 68, 102, 139, 155, 180, 38, 43, 68, 58, 68, 102, 38, 43, 68, 139, 155, 180, 38, 43, 68, 58, 68, 102, 38, 43, 68, 62, 39, 49, 58, 68, 102, 58, 68, 102, 58, 68, 102, 90, 105, 136, 38, 43, 68, 38, 43, 68, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 90, 105, 136, 38, 43, 68, 58, 68, 102, 58, 68, 102, 58, 68, 102, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 38, 43, 68, 58, 68, 102, 38, 43, 68, 62, 39, 49, 139, 155, 180, 38, 43, 68, 58, 68, 102, 62, 39, 49, 38, 43, 68, 58, 68, 102, 90, 105, 136, 90, 105, 136, 58, 68, 102, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 90, 105, 136, 58, 68, 102, 139, 155, 180, 38, 43, 68, 58, 68, 102, 38, 43, 68, 62, 39, 49, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 139, 155, 180, 58, 68, 102, 38, 43, 68, 38, 43, 68, 38, 43, 68, 62, 39, 49, 90, 105, 136, 38, 43, 68, 58, 68, 102, 62, 39, 49, 62, 39, 49, 58, 68, 102, 90, 105, 136, 58, 68, 102, 58, 68, 102, 139, 155, 180, 139, 155, 180, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 38, 43, 68, 139, 155, 180, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 62, 39, 49, 38, 43, 68, 139, 155, 180, 38, 43, 68, 62, 39, 49, 58, 68, 102, 62, 39, 49, 58, 68, 102, 139, 155, 180, 90, 105, 136, 139, 155, 180, 58, 68, 102, 58, 68, 102, 90, 105, 136, 90, 105, 136, 38, 43, 68, 58, 68, 102, 38, 43, 68, 139, 155, 180, 38, 43, 68, 38, 43, 68, 62, 39, 49, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 38, 43, 68, 62, 39, 49, 139, 155, 180, 38, 43, 68, 62, 39, 49, 38, 43, 68, 38, 43, 68, 139, 155, 180, 90, 105, 136, 90, 105, 136, 58, 68, 102, 58, 68, 102, 90, 105, 136, 58, 68, 102, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 139, 155, 180, 38, 43, 68, 62, 39, 49, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 38, 43, 68, 38, 43, 68, 38, 43, 68, 90, 105, 136, 38, 43, 68, 58, 68, 102, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 139, 155, 180, 90, 105, 136, 58, 68, 102, 90, 105, 136, 58, 68, 102, 90, 105, 136, 58, 68, 102, 58, 68, 102, 58, 68, 102, 38, 43, 68, 58, 68, 102, 38, 43, 68, 139, 155, 180, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 139, 155, 180, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 115, 62, 57, 38, 43, 68, 62, 39, 49, 90, 105, 136, 38, 43, 68, 139, 155, 180, 38, 43, 68, 38, 43, 68, 139, 155, 180, 90, 105, 136, 58, 68, 102, 90, 105, 136, 58, 68, 102, 58, 68, 102, 90, 105, 136, 58, 68, 102, 58, 68, 102, 38, 43, 68, 58, 68, 102, 38, 43, 68, 58, 68, 102, 90, 105, 136, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 139, 155, 180, 38, 43, 68, 38, 43, 68, 58, 68, 102, 58, 68, 102, 62, 39, 49, 62, 39, 49, 62, 39, 49, 58, 68, 102, 38, 43, 68, 90, 105, 136, 139, 155, 180, 38, 43, 68, 38, 43, 68, 90, 105, 136, 90, 105, 136, 90, 105, 136, 58, 68, 102, 90, 105, 136, 58, 68, 102, 58, 68, 102, 90, 105, 136, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 90, 105, 136, 38, 43, 68, 38, 43, 68, 38, 43, 68, 58, 68, 102, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 139, 155, 180, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 62, 39, 49, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 38, 43, 68, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 47, 31, 44, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 47, 31, 44, 47, 31, 44, 47, 31, 44, 47, 31, 44, 89, 51, 53, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 24, 20, 37, 47, 31, 44, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 89, 51, 53, 89, 51, 53, 89, 51, 53, 115, 62, 57, 115, 62, 57, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 47, 31, 44, 47, 31, 44, 24, 20, 37, 24, 20, 37, 47, 31, 44, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 115, 62, 57, 115, 62, 57, 115, 62, 57, 115, 62, 57, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 47, 31, 44, 89, 51, 53, 89, 51, 53, 89, 51, 53, 115, 62, 57, 115, 62, 57, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 89, 51, 53, 89, 51, 53, 115, 62, 57, 115, 62, 57, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 89, 51, 53, 89, 51, 53, 115, 62, 57, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 62, 39, 49, 62, 39, 49, 47, 31, 44, 47, 31, 44, 47, 31, 44, 47, 31, 44, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 62, 39, 49, 89, 51, 53, 115, 62, 57, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 62, 39, 49, 89, 51, 53, 89, 51, 53, 115, 62, 57, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 47, 31, 44, 47, 31, 44, 47, 31, 44, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 89, 51, 53, 89, 51, 53, 115, 62, 57, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 47, 31, 44, 89, 51, 53, 89, 51, 53, 89, 51, 53, 115, 62, 57, 115, 62, 57, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 89, 51, 53, 115, 62, 57, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 62, 39, 49, 89, 51, 53, 115, 62, 57, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 47, 31, 44, 47, 31, 44, 47, 31, 44, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 62, 39, 49, 62, 39, 49, 89, 51, 53, 89, 51, 53, 89, 51, 53, 115, 62, 57, 24, 20, 37, 24, 20, 37, 24, 20, 37, 24, 20, 37, 47, 31, 44, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 24, 20, 37, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 89, 51, 53, 24, 20, 37, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 89, 51, 53, 115, 62, 57, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 115, 62, 57, 24, 20, 37, 47, 31, 44, 47, 31, 44, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 62, 39, 49, 57, 95, 104, 38, 69, 71, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 38, 69, 71, 57, 95, 104, 38, 69, 71, 38, 69, 71, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 38, 69, 71, 38, 69, 71, 0, 83, 87, 43, 117, 125, 43, 117, 125, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 43, 117, 125, 43, 117, 125, 43, 117, 125, 0, 83, 87, 0, 83, 87, 43, 117, 125, 0, 168, 196, 0, 168, 196, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 43, 117, 125, 43, 117, 125, 43, 117, 125, 0, 83, 87, 0, 83, 87, 43, 117, 125, 0, 168, 196, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 43, 117, 125, 43, 117, 125, 0, 83, 87, 0, 83, 87, 43, 117, 125, 0, 168, 196, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 43, 117, 125, 43, 117, 125, 0, 83, 87, 0, 83, 87, 43, 117, 125, 0, 168, 196, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 43, 117, 125, 43, 117, 125, 0, 83, 87, 0, 83, 87, 43, 117, 125, 43, 117, 125, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 43, 117, 125, 43, 117, 125, 0, 83, 87, 0, 88, 93, 43, 117, 125, 43, 117, 125, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 43, 117, 125, 43, 117, 125, 0, 83, 87, 0, 88, 93, 43, 117, 125, 43, 117, 125, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 43, 117, 125, 43, 117, 125, 0, 88, 93, 0, 88, 93, 43, 117, 125, 43, 117, 125, 24, 80, 83, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 43, 117, 125, 43, 117, 125, 0, 88, 93, 0, 83, 87, 43, 117, 125, 43, 117, 125, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 43, 117, 125, 43, 117, 125, 0, 88, 93, 0, 83, 87, 43, 117, 125, 43, 117, 125, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 43, 117, 125, 43, 117, 125, 0, 83, 87, 0, 83, 87, 43, 117, 125, 43, 117, 125, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 43, 117, 125, 43, 117, 125, 0, 83, 87, 0, 83, 87, 43, 117, 125, 0, 168, 196, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 0, 168, 196, 43, 117, 125, 0, 83, 87, 0, 83, 87, 43, 117, 125, 0, 168, 196, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 0, 168, 196, 43, 117, 125, 0, 83, 87, 0, 88, 93, 43, 117, 125, 0, 168, 196, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 0, 168, 196, 43, 117, 125, 0, 83, 87, 0, 88, 93, 43, 117, 125, 0, 168, 196, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 0, 168, 196, 43, 117, 125, 0, 88, 93, 0, 88, 93, 43, 117, 125, 0, 168, 196, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 43, 117, 125, 43, 117, 125, 0, 88, 93, 0, 83, 87, 43, 117, 125, 0, 168, 196, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 43, 117, 125, 43, 117, 125, 0, 88, 93, 0, 88, 93, 43, 117, 125, 43, 117, 125, 38, 69, 71, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 43, 117, 125, 43, 117, 125, 0, 83, 87, 0, 88, 93, 43, 117, 125, 43, 117, 125, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 43, 117, 125, 43, 117, 125, 0, 88, 93, 0, 88, 93, 43, 117, 125, 43, 117, 125, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 43, 117, 125, 43, 117, 125, 0, 88, 93, 0, 83, 87, 43, 117, 125, 43, 117, 125, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 43, 117, 125, 43, 117, 125, 0, 88, 93, 0, 83, 87, 43, 117, 125, 43, 117, 125, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 0, 168, 196, 43, 117, 125, 0, 83, 87, 0, 83, 87, 43, 117, 125, 43, 117, 125, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 0, 168, 196, 43, 117, 125, 0, 83, 87, 0, 88, 93, 43, 117, 125, 43, 117, 125, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 0, 168, 196, 43, 117, 125, 0, 83, 87, 0, 88, 93, 43, 117, 125, 43, 117, 125, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 38, 69, 71, 0, 168, 196, 43, 117, 125, 0, 83, 87, 0, 83, 87, 43, 117, 125, 43, 117, 125, 43, 117, 125, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 24, 80, 83, 24, 80, 83, 24, 80, 83, 38, 69, 71, 38, 69, 71, 38, 69, 71, 0, 168, 196, 0, 168, 196, 43, 117, 125, 0, 83, 87, 0, 83, 87, 43, 117, 125, 43, 117, 125, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 0, 168, 196, 43, 117, 125, 43, 117, 125, 0, 83, 87, 38, 69, 71, 24, 80, 83, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 43, 117, 125, 38, 69, 71, 38, 69, 71, 57, 95, 104, 38, 69, 71, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 0, 83, 87, 38, 69, 71, 57, 95, 104, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 158, 111, 94, 148, 87, 60, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 148, 87, 60, 148, 87, 60, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 148, 87, 60, 148, 87, 60, 21, 29, 13, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 21, 29, 13, 148, 87, 60, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 148, 87, 60, 21, 29, 13, 24, 34, 16, 21, 29, 13, 21, 29, 13, 21, 29, 13, 29, 44, 20, 24, 34, 16, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 24, 34, 16, 21, 29, 13, 148, 87, 60, 160, 126, 108, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 148, 87, 60, 21, 29, 13, 24, 34, 16, 21, 29, 13, 20, 30, 14, 21, 29, 13, 21, 29, 13, 29, 44, 20, 24, 34, 16, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 24, 34, 16, 21, 29, 13, 148, 87, 60, 160, 126, 108, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 148, 87, 60, 21, 29, 13, 24, 34, 16, 21, 29, 13, 21, 29, 13, 20, 30, 14, 21, 29, 13, 21, 29, 13, 29, 44, 20, 24, 34, 16, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 24, 34, 16, 21, 29, 13, 148, 87, 60, 160, 126, 108, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 148, 87, 60, 21, 29, 13, 24, 34, 16, 24, 34, 16, 21, 29, 13, 21, 29, 13, 20, 30, 14, 20, 30, 14, 21, 29, 13, 29, 44, 20, 24, 34, 16, 24, 34, 16, 24, 34, 16, 21, 29, 13, 21, 29, 13, 24, 34, 16, 21, 29, 13, 148, 87, 60, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 21, 29, 13, 24, 34, 16, 29, 44, 20, 24, 34, 16, 21, 29, 13, 21, 29, 13, 20, 30, 14, 20, 30, 14, 21, 29, 13, 29, 44, 20, 29, 44, 20, 29, 44, 20, 24, 34, 16, 21, 29, 13, 24, 34, 16, 21, 29, 13, 148, 87, 60, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 21, 29, 13, 24, 34, 16, 29, 44, 20, 24, 34, 16, 21, 29, 13, 21, 29, 13, 20, 30, 14, 20, 30, 14, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 29, 44, 20, 24, 34, 16, 24, 34, 16, 21, 29, 13, 148, 87, 60, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 21, 29, 13, 24, 34, 16, 21, 29, 13, 29, 44, 20, 24, 34, 16, 21, 29, 13, 21, 29, 13, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 21, 29, 13, 21, 29, 13, 29, 44, 20, 24, 34, 16, 21, 29, 13, 148, 87, 60, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 21, 29, 13, 24, 34, 16, 21, 29, 13, 29, 44, 20, 24, 34, 16, 21, 29, 13, 21, 29, 13, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 21, 29, 13, 21, 29, 13, 24, 34, 16, 21, 29, 13, 148, 87, 60, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 148, 87, 60, 21, 29, 13, 24, 34, 16, 21, 29, 13, 21, 29, 13, 29, 44, 20, 24, 34, 16, 21, 29, 13, 21, 29, 13, 20, 30, 14, 20, 30, 14, 20, 30, 14, 21, 29, 13, 20, 30, 14, 21, 29, 13, 24, 34, 16, 21, 29, 13, 148, 87, 60, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 148, 87, 60, 21, 29, 13, 24, 34, 16, 21, 29, 13, 21, 29, 13, 29, 44, 20, 24, 34, 16, 21, 29, 13, 21, 29, 13, 21, 29, 13, 20, 30, 14, 20, 30, 14, 20, 30, 14, 21, 29, 13, 21, 29, 13, 24, 34, 16, 21, 29, 13, 148, 87, 60, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 148, 87, 60, 21, 29, 13, 24, 34, 16, 21, 29, 13, 21, 29, 13, 21, 29, 13, 29, 44, 20, 24, 34, 16, 21, 29, 13, 20, 30, 14, 20, 30, 14, 20, 30, 14, 21, 29, 13, 21, 29, 13, 21, 29, 13, 24, 34, 16, 21, 29, 13, 148, 87, 60, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 148, 87, 60, 21, 29, 13, 24, 34, 16, 21, 29, 13, 21, 29, 13, 21, 29, 13, 29, 44, 20, 24, 34, 16, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 24, 34, 16, 21, 29, 13, 148, 87, 60, 148, 87, 60, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 148, 87, 60, 148, 87, 60, 21, 29, 13, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 21, 29, 13, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 144, 72, 39, 20, 27, 12, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 20, 27, 12, 156, 115, 92, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 21, 29, 13, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 21, 29, 13, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 21, 29, 13, 24, 34, 16, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 24, 34, 16, 29, 44, 20, 21, 29, 13, 21, 29, 13, 21, 29, 13, 24, 34, 16, 21, 29, 13, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 152, 96, 74, 160, 126, 108, 21, 29, 13, 24, 34, 16, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 24, 34, 16, 29, 44, 20, 21, 29, 13, 21, 29, 13, 24, 34, 16, 21, 29, 13, 160, 126, 108, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 160, 126, 108, 21, 29, 13, 24, 34, 16, 21, 29, 13, 20, 30, 14, 21, 29, 13, 20, 30, 14, 20, 30, 14, 20, 30, 14, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 24, 34, 16, 21, 29, 13, 160, 126, 108, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 152, 96, 74, 160, 126, 108, 21, 29, 13, 24, 34, 16, 21, 29, 13, 21, 29, 13, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 24, 34, 16, 21, 29, 13, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 21, 29, 13, 24, 34, 16, 21, 29, 13, 21, 29, 13, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 21, 29, 13, 24, 34, 16, 21, 29, 13, 160, 126, 108, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 21, 29, 13, 24, 34, 16, 21, 29, 13, 20, 30, 14, 21, 29, 13, 20, 30, 14, 20, 30, 14, 21, 29, 13, 20, 30, 14, 20, 30, 14, 20, 30, 14, 21, 29, 13, 20, 30, 14, 21, 29, 13, 24, 34, 16, 21, 29, 13, 160, 126, 108, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 152, 96, 74, 152, 96, 74, 160, 126, 108, 21, 29, 13, 24, 34, 16, 20, 30, 14, 20, 30, 14, 21, 29, 13, 20, 30, 14, 21, 29, 13, 21, 29, 13, 20, 30, 14, 21, 29, 13, 20, 30, 14, 20, 30, 14, 21, 29, 13, 21, 29, 13, 24, 34, 16, 21, 29, 13, 160, 126, 108, 152, 96, 74, 152, 96, 74, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 160, 126, 108, 21, 29, 13, 24, 34, 16, 20, 30, 14, 21, 29, 13, 29, 44, 20, 24, 34, 16, 21, 29, 13, 21, 29, 13, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 20, 30, 14, 21, 29, 13, 24, 34, 16, 21, 29, 13, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 160, 126, 108, 21, 29, 13, 24, 34, 16, 21, 29, 13, 20, 30, 14, 21, 29, 13, 29, 44, 20, 24, 34, 16, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 20, 30, 14, 21, 29, 13, 21, 29, 13, 24, 34, 16, 21, 29, 13, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 21, 29, 13, 24, 34, 16, 20, 30, 14, 20, 30, 14, 21, 29, 13, 29, 44, 20, 24, 34, 16, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 20, 30, 14, 21, 29, 13, 24, 34, 16, 21, 29, 13, 160, 126, 108, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 21, 29, 13, 24, 34, 16, 21, 29, 13, 20, 30, 14, 20, 30, 14, 21, 29, 13, 29, 44, 20, 24, 34, 16, 24, 34, 16, 21, 29, 13, 21, 29, 13, 20, 30, 14, 21, 29, 13, 21, 29, 13, 24, 34, 16, 21, 29, 13, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 21, 29, 13, 24, 34, 16, 21, 29, 13, 21, 29, 13, 20, 30, 14, 21, 29, 13, 21, 29, 13, 29, 44, 20, 24, 34, 16, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 24, 34, 16, 21, 29, 13, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 21, 29, 13, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 24, 34, 16, 21, 29, 13, 160, 126, 108, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 148, 87, 60, 152, 96, 74, 152, 96, 74, 148, 87, 60, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 152, 96, 74, 160, 126, 108, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 21, 29, 13, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 160, 126, 108, 9, 7, 7, 0, 0, 0, 0, 0, 0, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 9, 7, 7, 0, 0, 0, 0, 0, 0, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 0, 0, 0, 55, 81, 74, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 55, 81, 74, 9, 7, 7, 21, 31, 31, 21, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 31, 31, 55, 81, 74, 55, 81, 74, 9, 7, 7, 21, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 9, 7, 7, 55, 81, 74, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 55, 81, 74, 55, 81, 74, 55, 81, 74, 9, 7, 7, 21, 31, 31, 21, 31, 31, 21, 31, 31, 0, 0, 0, 0, 0, 0, 21, 31, 31, 9, 7, 7, 32, 47, 43, 55, 81, 74, 55, 81, 74, 55, 81, 74, 32, 47, 43, 55, 81, 74, 32, 47, 43, 32, 47, 43, 9, 7, 7, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 21, 31, 31, 21, 31, 31, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 32, 47, 43, 9, 7, 7, 55, 81, 74, 55, 81, 74, 21, 31, 31, 21, 31, 31, 21, 31, 31, 55, 81, 74, 9, 7, 7, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 32, 47, 43, 9, 7, 7, 9, 7, 7, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 9, 7, 7, 9, 7, 7, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 55, 81, 74, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 0, 0, 0, 0, 0, 0, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 0, 0, 0, 9, 7, 7, 0, 0, 0, 55, 81, 74, 32, 47, 43, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 55, 81, 74, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 9, 7, 7, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 9, 7, 7, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 55, 81, 74, 32, 47, 43, 32, 47, 43, 9, 7, 7, 9, 7, 7, 0, 0, 0, 0, 0, 0, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 9, 7, 7, 9, 7, 7, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 9, 7, 7, 9, 7, 7, 0, 0, 0, 0, 0, 0, 9, 7, 7, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 9, 7, 7, 0, 0, 0, 9, 7, 7, 0, 0, 0, 21, 31, 31, 32, 47, 43, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 21, 31, 31, 21, 31, 31, 21, 31, 31, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 0, 0, 0, 0, 0, 0, 21, 31, 31, 9, 7, 7, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 21, 31, 31, 21, 31, 31, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 55, 81, 74, 9, 7, 7, 55, 81, 74, 55, 81, 74, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 55, 81, 74, 55, 81, 74, 32, 47, 43, 55, 81, 74, 55, 81, 74, 55, 81, 74, 9, 7, 7, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 55, 81, 74, 55, 81, 74, 55, 81, 74, 9, 7, 7, 55, 81, 74, 32, 47, 43, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 55, 81, 74, 32, 47, 43, 9, 7, 7, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 9, 7, 7, 9, 7, 7, 9, 7, 7, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 0, 0, 0, 9, 7, 7, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 32, 47, 43, 55, 81, 74, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 0, 0, 0, 0, 0, 0, 9, 7, 7, 55, 81, 74, 32, 47, 43, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 32, 47, 43, 32, 47, 43, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 32, 47, 43, 32, 47, 43, 55, 81, 74, 32, 47, 43, 55, 81, 74, 55, 81, 74, 32, 47, 43, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 0, 0, 0, 0, 0, 0, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 31, 31, 21, 31, 31, 0, 0, 0, 0, 0, 0, 9, 7, 7, 9, 7, 7, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 9, 7, 7, 0, 0, 0, 21, 31, 31, 21, 31, 31, 55, 81, 74, 32, 47, 43, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 9, 7, 7, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 55, 81, 74, 21, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 9, 7, 7, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 0, 0, 0, 0, 0, 0, 21, 31, 31, 21, 31, 31, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 21, 31, 31, 21, 31, 31, 32, 47, 43, 9, 7, 7, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 21, 31, 31, 21, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 9, 7, 7, 32, 47, 43, 9, 7, 7, 9, 7, 7, 21, 31, 31, 21, 31, 31, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 32, 47, 43, 32, 47, 43, 9, 7, 7, 55, 81, 74, 55, 81, 74, 55, 81, 74, 32, 47, 43, 55, 81, 74, 32, 47, 43, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 21, 31, 31, 0, 0, 0, 9, 7, 7, 0, 0, 0, 0, 0, 0, 9, 7, 7, 0, 0, 0, 9, 7, 7, 21, 31, 31, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 32, 47, 43, 55, 81, 74, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 55, 81, 74, 32, 47, 43, 55, 81, 74, 55, 81, 74, 55, 81, 74, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 32, 47, 43, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 9, 7, 7, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 21, 31, 31, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 0, 0, 0, 0, 0, 0, 9, 7, 7, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 0, 0, 0, 0, 0, 0, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 31, 31, 21, 31, 31, 21, 31, 31, 55, 81, 74, 55, 81, 74, 21, 31, 31, 21, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 0, 0, 0, 9, 7, 7, 9, 7, 7, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 47, 43, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 32, 47, 43, 0, 0, 0, 9, 7, 7, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 21, 31, 31, 0, 0, 0, 0, 0, 0, 9, 7, 7, 21, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 9, 7, 7, 9, 7, 7, 32, 47, 43, 32, 47, 43, 55, 81, 74, 55, 81, 74, 32, 47, 43, 55, 81, 74, 32, 47, 43, 55, 81, 74, 55, 81, 74, 32, 47, 43, 32, 47, 43, 9, 7, 7, 21, 31, 31, 21, 31, 31, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 55, 81, 74, 55, 81, 74, 21, 31, 31, 21, 31, 31, 21, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 21, 31, 31, 21, 31, 31, 21, 31, 31, 55, 81, 74, 55, 81, 74, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 9, 7, 7, 9, 7, 7, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 0, 0, 0, 0, 0, 0, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 32, 47, 43, 32, 47, 43, 9, 7, 7, 21, 31, 31, 21, 31, 31, 21, 31, 31, 55, 81, 74, 55, 81, 74, 32, 47, 43, 55, 81, 74, 32, 47, 43, 21, 31, 31, 21, 31, 31, 32, 47, 43, 9, 7, 7, 55, 81, 74, 55, 81, 74, 9, 7, 7, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 21, 31, 31, 21, 31, 31, 21, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 9, 7, 7, 21, 31, 31, 21, 31, 31, 55, 81, 74, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 21, 31, 31, 21, 31, 31, 21, 31, 31, 9, 7, 7, 32, 47, 43, 32, 47, 43, 55, 81, 74, 32, 47, 43, 9, 7, 7, 9, 7, 7, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 55, 81, 74, 55, 81, 74, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 21, 31, 31, 21, 31, 31, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 21, 31, 31, 21, 31, 31, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 55, 81, 74, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 9, 7, 7, 21, 31, 31, 32, 47, 43, 32, 47, 43, 32, 47, 43, 32, 47, 43, 21, 31, 31, 9, 7, 7, 9, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 7, 9, 7, 7, 9, 7, 7, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 21, 31, 31, 9, 7, 7, 9, 7, 7, 9, 7, 7, 9, 7, 7, 21, 31, 31, 21, 31, 31, 21, 31, 31, 32, 47, 43, 21, 31, 31, 21, 31, 31, 116, 28, 0, 116, 28, 0, 98, 24, 0, 242, 47, 0, 253, 200, 70, 250, 154, 0, 242, 47, 0, 242, 47, 0, 103, 21, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 98, 24, 0, 242, 47, 0, 250, 154, 0, 253, 200, 70, 250, 154, 0, 242, 47, 0, 250, 154, 0, 242, 47, 0, 250, 154, 0, 103, 21, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 152, 15, 0, 98, 24, 0, 242, 47, 0, 250, 154, 0, 253, 200, 70, 253, 200, 70, 242, 47, 0, 103, 21, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 98, 24, 0, 98, 24, 0, 242, 47, 0, 250, 154, 0, 253, 200, 70, 253, 200, 70, 242, 47, 0, 250, 154, 0, 250, 154, 0, 250, 154, 0, 250, 154, 0, 242, 47, 0, 103, 21, 0, 103, 21, 0, 103, 21, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 103, 21, 0, 242, 47, 0, 250, 154, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 253, 200, 70, 242, 47, 0, 103, 21, 0, 103, 21, 0, 152, 15, 0, 152, 15, 0, 103, 21, 0, 103, 21, 0, 242, 47, 0, 242, 47, 0, 250, 154, 0, 253, 200, 70, 253, 200, 70, 253, 200, 70, 250, 154, 0, 152, 15, 0, 242, 47, 0, 250, 154, 0, 253, 200, 70, 250, 154, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 103, 21, 0, 103, 21, 0, 103, 21, 0, 242, 47, 0, 250, 154, 0, 250, 154, 0, 250, 154, 0, 253, 200, 70, 250, 154, 0, 253, 200, 70, 253, 200, 70, 250, 154, 0, 242, 47, 0, 103, 21, 0, 103, 21, 0, 242, 47, 0, 250, 154, 0, 250, 154, 0, 250, 154, 0, 250, 154, 0, 253, 200, 70, 253, 200, 70, 250, 154, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 250, 154, 0, 250, 154, 0, 250, 154, 0, 250, 154, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 253, 200, 70, 250, 154, 0, 242, 47, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 250, 154, 0, 250, 154, 0, 250, 154, 0, 250, 154, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 250, 154, 0, 250, 154, 0, 242, 47, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 250, 154, 0, 242, 47, 0, 242, 47, 0, 250, 154, 0, 250, 154, 0, 242, 47, 0, 242, 47, 0, 152, 15, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 242, 47, 0, 110, 20, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 110, 20, 0, 242, 47, 0, 250, 154, 0, 242, 47, 0, 242, 47, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 242, 47, 0, 250, 154, 0, 253, 200, 70, 242, 47, 0, 242, 47, 0, 242, 47, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 250, 154, 0, 242, 47, 0, 253, 200, 70, 242, 47, 0, 110, 20, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 105, 22, 0, 250, 154, 0, 242, 47, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 242, 47, 0, 242, 47, 0, 250, 154, 0, 242, 47, 0, 242, 47, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 250, 154, 0, 152, 15, 0, 242, 47, 0, 253, 200, 70, 242, 47, 0, 110, 20, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 105, 22, 0, 250, 154, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 242, 47, 0, 253, 200, 70, 250, 154, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 253, 200, 70, 242, 47, 0, 105, 22, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 105, 22, 0, 250, 154, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 253, 200, 70, 253, 200, 70, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 242, 47, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 250, 154, 0, 253, 200, 70, 242, 47, 0, 105, 22, 0, 152, 15, 0, 152, 15, 0, 105, 22, 0, 105, 22, 0, 242, 47, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 242, 47, 0, 110, 20, 0, 110, 20, 0, 242, 47, 0, 253, 200, 70, 242, 47, 0, 110, 20, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 110, 20, 0, 253, 200, 70, 253, 200, 70, 242, 47, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 242, 47, 0, 152, 15, 0, 242, 47, 0, 253, 200, 70, 242, 47, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 253, 200, 70, 110, 20, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 110, 20, 0, 250, 154, 0, 253, 200, 70, 242, 47, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 242, 47, 0, 242, 47, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 250, 154, 0, 253, 200, 70, 253, 200, 70, 253, 200, 70, 242, 47, 0, 110, 20, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 110, 20, 0, 242, 47, 0, 242, 47, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 242, 47, 0, 242, 47, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 253, 200, 70, 242, 47, 0, 242, 47, 0, 242, 47, 0, 110, 20, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 105, 22, 0, 242, 47, 0, 250, 154, 0, 242, 47, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 242, 47, 0, 242, 47, 0, 250, 154, 0, 242, 47, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 110, 20, 0, 250, 154, 0, 242, 47, 0, 242, 47, 0, 105, 22, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 105, 22, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 242, 47, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 242, 47, 0, 250, 154, 0, 250, 154, 0, 242, 47, 0, 110, 20, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 110, 20, 0, 242, 47, 0, 250, 154, 0, 242, 47, 0, 242, 47, 0, 110, 20, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 105, 22, 0, 242, 47, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 250, 154, 0, 242, 47, 0, 152, 15, 0, 242, 47, 0, 250, 154, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 242, 47, 0, 110, 20, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 110, 20, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 242, 47, 0, 242, 47, 0, 110, 20, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 110, 20, 0, 242, 47, 0, 242, 47, 0, 250, 154, 0, 253, 200, 70, 250, 154, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 253, 200, 70, 253, 200, 70, 242, 47, 0, 110, 20, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 110, 20, 0, 242, 47, 0, 242, 47, 0, 250, 154, 0, 242, 47, 0, 250, 154, 0, 110, 20, 0, 152, 15, 0, 110, 20, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 253, 200, 70, 242, 47, 0, 242, 47, 0, 152, 15, 0, 242, 47, 0, 242, 47, 0, 250, 154, 0, 253, 200, 70, 253, 200, 70, 253, 200, 70, 242, 47, 0, 110, 20, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 110, 20, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 253, 200, 70, 242, 47, 0, 110, 20, 0, 242, 47, 0, 242, 47, 0, 116, 28, 0, 116, 28, 0, 105, 22, 0, 253, 200, 70, 242, 47, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 250, 154, 0, 250, 154, 0, 242, 47, 0, 110, 20, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 110, 20, 0, 242, 47, 0, 250, 154, 0, 253, 200, 70, 253, 200, 70, 242, 47, 0, 242, 47, 0, 242, 47, 0, 152, 15, 0, 152, 15, 0, 105, 22, 0, 105, 22, 0, 253, 200, 70, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 250, 154, 0, 242, 47, 0, 110, 20, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 110, 20, 0, 242, 47, 0, 253, 200, 70, 242, 47, 0, 250, 154, 0, 242, 47, 0, 110, 20, 0, 152, 15, 0, 152, 15, 0, 110, 20, 0, 242, 47, 0, 253, 200, 70, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 98, 24, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 105, 22, 0, 242, 47, 0, 253, 200, 70, 250, 154, 0, 242, 47, 0, 242, 47, 0, 110, 20, 0, 110, 20, 0, 110, 20, 0, 110, 20, 0, 242, 47, 0, 250, 154, 0, 242, 47, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 242, 47, 0, 250, 154, 0, 242, 47, 0, 242, 47, 0, 98, 24, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 105, 22, 0, 250, 154, 0, 253, 200, 70, 250, 154, 0, 242, 47, 0, 242, 47, 0, 250, 154, 0, 250, 154, 0, 250, 154, 0, 250, 154, 0, 250, 154, 0, 250, 154, 0, 242, 47, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 250, 154, 0, 253, 200, 70, 250, 154, 0, 242, 47, 0, 242, 47, 0, 98, 24, 0, 98, 24, 0, 103, 21, 0, 103, 21, 0, 152, 15, 0, 152, 15, 0, 110, 20, 0, 250, 154, 0, 253, 200, 70, 250, 154, 0, 242, 47, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 250, 154, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 250, 154, 0, 242, 47, 0, 250, 154, 0, 253, 200, 70, 242, 47, 0, 242, 47, 0, 103, 21, 0, 103, 21, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 242, 47, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 103, 21, 0, 250, 154, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 250, 154, 0, 253, 200, 70, 253, 200, 70, 250, 154, 0, 253, 200, 70, 253, 200, 70, 250, 154, 0, 250, 154, 0, 250, 154, 0, 250, 154, 0, 250, 154, 0, 242, 47, 0, 242, 47, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 103, 21, 0, 250, 154, 0, 250, 154, 0, 242, 47, 0, 116, 28, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 242, 47, 0, 242, 47, 0, 253, 200, 70, 253, 200, 70, 253, 200, 70, 253, 200, 70, 250, 154, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 242, 47, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 103, 21, 0, 242, 47, 0, 242, 47, 0, 250, 154, 0, 242, 47, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 98, 24, 0, 242, 47, 0, 242, 47, 0, 250, 154, 0, 253, 200, 70, 242, 47, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 98, 24, 0, 242, 47, 0, 242, 47, 0, 250, 154, 0, 250, 154, 0, 103, 21, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 98, 24, 0, 242, 47, 0, 253, 200, 70, 242, 47, 0, 242, 47, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 98, 24, 0, 250, 154, 0, 242, 47, 0, 250, 154, 0, 242, 47, 0, 242, 47, 0, 103, 21, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 98, 24, 0, 253, 200, 70, 253, 200, 70, 103, 21, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 98, 24, 0, 250, 154, 0, 250, 154, 0, 253, 200, 70, 250, 154, 0, 242, 47, 0, 103, 21, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 98, 24, 0, 242, 47, 0, 253, 200, 70, 242, 47, 0, 103, 21, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 103, 21, 0, 250, 154, 0, 242, 47, 0, 250, 154, 0, 253, 200, 70, 250, 154, 0, 242, 47, 0, 103, 21, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 103, 21, 0, 253, 200, 70, 250, 154, 0, 242, 47, 0, 103, 21, 0, 103, 21, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 116, 28, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 103, 21, 0, 242, 47, 0, 250, 154, 0, 250, 154, 0, 250, 154, 0, 253, 200, 70, 250, 154, 0, 242, 47, 0, 242, 47, 0, 103, 21, 0, 152, 15, 0, 152, 15, 0, 152, 15, 0, 116, 28, 0, 116, 28, 0, 155, 245, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 0, 186, 247, 0, 186, 247, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 155, 245, 255, 71, 228, 255, 155, 245, 255, 71, 228, 255, 3, 206, 255, 3, 206, 255, 155, 245, 255, 3, 206, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 71, 228, 255, 71, 228, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 3, 206, 255, 155, 245, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 155, 245, 255, 155, 245, 255, 155, 245, 255, 71, 228, 255, 0, 186, 247, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 155, 245, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 155, 245, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 155, 245, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 3, 206, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 155, 245, 255, 155, 245, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 155, 245, 255, 155, 245, 255, 155, 245, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 155, 245, 255, 71, 228, 255, 3, 206, 255, 155, 245, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 155, 245, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 0, 186, 247, 0, 186, 247, 155, 245, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 155, 245, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 155, 245, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 155, 245, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 3, 206, 255, 155, 245, 255, 0, 186, 247, 71, 228, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 71, 228, 255, 155, 245, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 155, 245, 255, 71, 228, 255, 3, 206, 255, 0, 186, 247, 3, 206, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 3, 206, 255, 3, 206, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 3, 206, 255, 71, 228, 255, 155, 245, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 3, 206, 255, 71, 228, 255, 155, 245, 255, 71, 228, 255, 3, 206, 255, 71, 228, 255, 3, 206, 255, 3, 206, 255, 155, 245, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 155, 245, 255, 71, 228, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 71, 228, 255, 71, 228, 255, 3, 206, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 3, 206, 255, 71, 228, 255, 3, 206, 255, 3, 206, 255, 0, 186, 247, 3, 206, 255, 71, 228, 255, 71, 228, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 3, 206, 255, 3, 206, 255, 155, 245, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 3, 206, 255, 155, 245, 255, 3, 206, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 155, 245, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 71, 228, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 155, 245, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 155, 245, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 71, 228, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 155, 245, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 3, 206, 255, 3, 206, 255, 71, 228, 255, 155, 245, 255, 155, 245, 255, 71, 228, 255, 155, 245, 255, 71, 228, 255, 155, 245, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 155, 245, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 155, 245, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 155, 245, 255, 3, 206, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 71, 228, 255, 3, 206, 255, 155, 245, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 71, 228, 255, 71, 228, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 3, 206, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 0, 186, 247, 3, 206, 255, 0, 186, 247, 0, 186, 247, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 155, 245, 255, 155, 245, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 3, 206, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 155, 245, 255, 71, 228, 255, 71, 228, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 3, 206, 255, 71, 228, 255, 3, 206, 255, 3, 206, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 71, 228, 255, 3, 206, 255, 71, 228, 255, 3, 206, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 3, 206, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 71, 228, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 71, 228, 255, 155, 245, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 155, 245, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 155, 245, 255, 3, 206, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 71, 228, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 155, 245, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 155, 245, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 71, 228, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 71, 228, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 71, 228, 255, 155, 245, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 71, 228, 255, 71, 228, 255, 71, 228, 255, 0, 186, 247, 0, 186, 247, 71, 228, 255, 155, 245, 255, 3, 206, 255, 3, 206, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 0, 186, 247, 3, 206, 255, 3, 206, 255, 0, 186, 247, 0, 186, 247, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 155, 245, 255, 3, 206, 255, 94, 92, 85, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 94, 92, 85, 124, 122, 112, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 52, 51, 48, 77, 75, 70, 94, 92, 85, 77, 75, 70, 52, 51, 48, 94, 92, 85, 94, 92, 85, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 124, 122, 112, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 52, 51, 48, 52, 51, 48, 77, 75, 70, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 77, 75, 70, 52, 51, 48, 52, 51, 48, 124, 122, 112, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 94, 92, 85, 124, 122, 112, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 124, 122, 112, 77, 75, 70, 77, 75, 70, 52, 51, 48, 52, 51, 48, 77, 75, 70, 77, 75, 70, 124, 122, 112, 52, 51, 48, 52, 51, 48, 52, 51, 48, 124, 122, 112, 94, 92, 85, 124, 122, 112, 124, 122, 112, 77, 75, 70, 77, 75, 70, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 124, 122, 112, 52, 51, 48, 52, 51, 48, 52, 51, 48, 124, 122, 112, 94, 92, 85, 124, 122, 112, 124, 122, 112, 124, 122, 112, 52, 51, 48, 52, 51, 48, 124, 122, 112, 94, 92, 85, 52, 51, 48, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 124, 122, 112, 52, 51, 48, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 52, 51, 48, 77, 75, 70, 77, 75, 70, 52, 51, 48, 124, 122, 112, 94, 92, 85, 124, 122, 112, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 94, 92, 85, 94, 92, 85, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 77, 75, 70, 94, 92, 85, 52, 51, 48, 124, 122, 112, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 94, 92, 85, 94, 92, 85, 52, 51, 48, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 52, 51, 48, 77, 75, 70, 124, 122, 112, 94, 92, 85, 124, 122, 112, 124, 122, 112, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 77, 75, 70, 77, 75, 70, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 77, 75, 70, 94, 92, 85, 77, 75, 70, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 77, 75, 70, 52, 51, 48, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 124, 122, 112, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 52, 51, 48, 52, 51, 48, 124, 122, 112, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 124, 122, 112, 124, 122, 112, 52, 51, 48, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 124, 122, 112, 94, 92, 85, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 124, 122, 112, 52, 51, 48, 52, 51, 48, 94, 92, 85, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 124, 122, 112, 94, 92, 85, 77, 75, 70, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 94, 92, 85, 124, 122, 112, 52, 51, 48, 77, 75, 70, 52, 51, 48, 52, 51, 48, 77, 75, 70, 77, 75, 70, 77, 75, 70, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 124, 122, 112, 52, 51, 48, 77, 75, 70, 77, 75, 70, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 52, 51, 48, 124, 122, 112, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 124, 122, 112, 52, 51, 48, 52, 51, 48, 52, 51, 48, 77, 75, 70, 77, 75, 70, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 94, 92, 85, 94, 92, 85, 77, 75, 70, 124, 122, 112, 94, 92, 85, 124, 122, 112, 52, 51, 48, 52, 51, 48, 124, 122, 112, 124, 122, 112, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 52, 51, 48, 124, 122, 112, 124, 122, 112, 124, 122, 112, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 77, 75, 70, 77, 75, 70, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 94, 92, 85, 94, 92, 85, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 77, 75, 70, 77, 75, 70, 77, 75, 70, 77, 75, 70, 52, 51, 48, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 77, 75, 70, 94, 92, 85, 52, 51, 48, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 77, 75, 70, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 52, 51, 48, 77, 75, 70, 52, 51, 48, 124, 122, 112, 124, 122, 112, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 124, 122, 112, 52, 51, 48, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 52, 51, 48, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 124, 122, 112, 77, 75, 70, 77, 75, 70, 124, 122, 112, 124, 122, 112, 94, 92, 85, 52, 51, 48, 124, 122, 112, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 52, 51, 48, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 94, 92, 85, 94, 92, 85, 77, 75, 70, 124, 122, 112, 94, 92, 85, 124, 122, 112, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 94, 92, 85, 77, 75, 70, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 77, 75, 70, 94, 92, 85, 77, 75, 70, 77, 75, 70, 77, 75, 70, 124, 122, 112, 52, 51, 48, 52, 51, 48, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 77, 75, 70, 77, 75, 70, 77, 75, 70, 52, 51, 48, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 94, 92, 85, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 52, 51, 48, 77, 75, 70, 124, 122, 112, 52, 51, 48, 124, 122, 112, 94, 92, 85, 124, 122, 112, 124, 122, 112, 124, 122, 112, 52, 51, 48, 77, 75, 70, 77, 75, 70, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 77, 75, 70, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 52, 51, 48, 94, 92, 85, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 124, 122, 112, 94, 92, 85, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 52, 51, 48, 124, 122, 112, 124, 122, 112, 52, 51, 48, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 124, 122, 112, 94, 92, 85, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 94, 92, 85, 94, 92, 85, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 94, 92, 85, 77, 75, 70, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 77, 75, 70, 52, 51, 48, 124, 122, 112, 77, 75, 70, 52, 51, 48, 52, 51, 48, 52, 51, 48, 77, 75, 70, 94, 92, 85, 77, 75, 70, 77, 75, 70, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 77, 75, 70, 77, 75, 70, 77, 75, 70, 124, 122, 112, 124, 122, 112, 124, 122, 112, 124, 122, 112, 124, 122, 112, 77, 75, 70, 77, 75, 70, 77, 75, 70, 77, 75, 70, 52, 51, 48, 52, 51, 48, 94, 92, 85, 124, 122, 112, 124, 122, 112, 52, 51, 48, 52, 51, 48, 124, 122, 112, 124, 122, 112, 124, 122, 112, 52, 51, 48, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 52, 51, 48, 124, 122, 112, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 52, 51, 48, 52, 51, 48, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 52, 51, 48, 77, 75, 70, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 52, 51, 48, 52, 51, 48, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 94, 92, 85, 124, 122, 112, 52, 51, 48, 52, 51, 48, 124, 122, 112, 94, 92, 85, 94, 92, 85, 94, 92, 85, 90, 63, 29, 93, 64, 30, 155, 101, 51, 155, 101, 51, 151, 97, 50, 113, 73, 36, 155, 101, 51, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 113, 73, 36, 90, 63, 29, 90, 63, 29, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 155, 101, 51, 90, 63, 29, 90, 63, 29, 140, 88, 45, 155, 101, 51, 113, 73, 36, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 113, 73, 36, 90, 63, 29, 90, 63, 29, 140, 88, 45, 155, 101, 51, 155, 101, 51, 113, 73, 36, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 90, 63, 29, 151, 97, 50, 113, 73, 36, 113, 73, 36, 155, 101, 51, 155, 101, 51, 90, 63, 29, 90, 63, 29, 140, 88, 45, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 93, 64, 30, 140, 88, 45, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 113, 73, 36, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 113, 73, 36, 140, 88, 45, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 90, 63, 29, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 137, 87, 44, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 90, 63, 29, 90, 63, 29, 113, 73, 36, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 90, 63, 29, 90, 63, 29, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 93, 64, 30, 140, 88, 45, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 113, 73, 36, 113, 73, 36, 140, 88, 45, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 93, 64, 30, 140, 88, 45, 155, 101, 51, 113, 73, 36, 90, 63, 29, 93, 64, 30, 113, 73, 36, 140, 88, 45, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 93, 64, 30, 140, 88, 45, 155, 101, 51, 113, 73, 36, 90, 63, 29, 137, 87, 44, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 93, 64, 30, 140, 88, 45, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 113, 73, 36, 90, 63, 29, 113, 73, 36, 140, 88, 45, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 113, 73, 36, 93, 64, 30, 140, 88, 45, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 90, 63, 29, 113, 73, 36, 155, 101, 51, 113, 73, 36, 90, 63, 29, 137, 87, 44, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 113, 73, 36, 93, 64, 30, 140, 88, 45, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 68, 46, 21, 155, 101, 51, 155, 101, 51, 155, 101, 51, 90, 63, 29, 90, 63, 29, 68, 46, 21, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 68, 46, 21, 155, 101, 51, 155, 101, 51, 90, 63, 29, 90, 63, 29, 140, 88, 45, 68, 46, 21, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 68, 46, 21, 155, 101, 51, 90, 63, 29, 90, 63, 29, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 90, 63, 29, 113, 73, 36, 68, 46, 21, 90, 63, 29, 90, 63, 29, 155, 101, 51, 90, 63, 29, 90, 63, 29, 68, 46, 21, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 90, 63, 29, 90, 63, 29, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 90, 63, 29, 90, 63, 29, 155, 101, 51, 155, 101, 51, 90, 63, 29, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 90, 63, 29, 113, 73, 36, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 90, 63, 29, 113, 73, 36, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 90, 63, 29, 137, 87, 44, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 90, 63, 29, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 90, 63, 29, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 90, 63, 29, 90, 63, 29, 113, 73, 36, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 151, 97, 50, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 90, 63, 29, 90, 63, 29, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 90, 63, 29, 93, 64, 30, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 113, 73, 36, 113, 73, 36, 90, 63, 29, 113, 73, 36, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 113, 73, 36, 113, 73, 36, 90, 63, 29, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 113, 73, 36, 113, 73, 36, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 140, 88, 45, 140, 88, 45, 113, 73, 36, 93, 64, 30, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 113, 73, 36, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 113, 73, 36, 140, 88, 45, 113, 73, 36, 93, 64, 30, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 90, 63, 29, 90, 63, 29, 140, 88, 45, 113, 73, 36, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 90, 63, 29, 90, 63, 29, 140, 88, 45, 113, 73, 36, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 151, 97, 50, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 90, 63, 29, 90, 63, 29, 140, 88, 45, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 113, 73, 36, 90, 63, 29, 113, 73, 36, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 113, 73, 36, 68, 46, 21, 155, 101, 51, 155, 101, 51, 155, 101, 51, 90, 63, 29, 90, 63, 29, 68, 46, 21, 113, 73, 36, 155, 101, 51, 151, 97, 50, 155, 101, 51, 155, 101, 51, 155, 101, 51, 151, 97, 50, 155, 101, 51, 113, 73, 36, 68, 46, 21, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 155, 101, 51, 68, 46, 21, 113, 73, 36, 45, 45, 45, 45, 45, 45, 48, 44, 44, 48, 44, 48, 52, 44, 52, 52, 44, 52, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 52, 44, 52, 52, 44, 52, 48, 44, 48, 48, 44, 44, 45, 45, 45, 45, 45, 45, 45, 45, 45, 49, 45, 49, 53, 45, 53, 62, 42, 58, 71, 41, 67, 77, 39, 73, 83, 38, 75, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 75, 77, 39, 73, 71, 41, 67, 62, 42, 58, 53, 45, 53, 49, 45, 49, 45, 45, 45, 48, 44, 48, 53, 45, 53, 68, 41, 64, 89, 37, 81, 109, 32, 102, 122, 30, 112, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 122, 30, 112, 109, 32, 102, 89, 37, 81, 68, 41, 64, 53, 45, 53, 48, 44, 48, 48, 44, 48, 62, 42, 58, 89, 37, 81, 122, 30, 112, 155, 22, 143, 167, 19, 153, 171, 18, 154, 169, 18, 155, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 169, 18, 155, 171, 18, 154, 167, 19, 153, 155, 22, 143, 122, 30, 112, 89, 37, 81, 62, 42, 58, 48, 44, 48, 52, 44, 52, 71, 41, 67, 109, 32, 102, 155, 22, 143, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 155, 22, 143, 109, 32, 102, 71, 41, 67, 52, 44, 52, 52, 44, 52, 80, 38, 76, 122, 30, 112, 167, 19, 153, 255, 0, 254, 201, 12, 180, 190, 14, 171, 179, 17, 161, 171, 18, 154, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 171, 18, 154, 179, 17, 161, 190, 14, 171, 201, 12, 180, 255, 0, 254, 167, 19, 153, 122, 30, 112, 80, 38, 76, 52, 44, 52, 54, 42, 54, 83, 38, 79, 126, 28, 116, 171, 18, 156, 255, 0, 254, 190, 14, 174, 169, 18, 155, 145, 24, 136, 130, 27, 120, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 130, 27, 120, 145, 24, 136, 169, 18, 155, 190, 14, 174, 255, 0, 254, 171, 18, 156, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 169, 18, 155, 255, 0, 254, 179, 17, 161, 147, 24, 135, 112, 32, 105, 90, 36, 87, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 90, 36, 87, 112, 32, 105, 147, 24, 135, 179, 17, 161, 255, 0, 254, 169, 18, 155, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 169, 18, 152, 255, 0, 254, 171, 18, 156, 130, 27, 120, 90, 36, 87, 66, 42, 66, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 66, 42, 66, 90, 36, 87, 130, 27, 120, 171, 18, 156, 255, 0, 254, 169, 18, 152, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 55, 43, 55, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 55, 43, 55, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 55, 43, 55, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 55, 43, 55, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 55, 43, 55, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 55, 43, 55, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 55, 43, 55, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 55, 43, 55, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 55, 43, 55, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 55, 43, 55, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 55, 43, 55, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 55, 43, 55, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 55, 43, 55, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 55, 43, 55, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 55, 43, 55, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 55, 43, 55, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 55, 43, 55, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 55, 43, 55, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 55, 43, 55, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 55, 43, 55, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 55, 43, 55, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 55, 43, 55, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 55, 43, 55, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 55, 43, 55, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 55, 43, 55, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 55, 43, 55, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 55, 43, 55, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 55, 43, 55, 83, 38, 79, 126, 28, 116, 167, 19, 153, 255, 0, 254, 167, 19, 153, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 169, 18, 152, 255, 0, 254, 171, 18, 156, 130, 27, 120, 90, 36, 87, 66, 42, 66, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 55, 43, 55, 66, 42, 66, 90, 36, 87, 130, 27, 120, 171, 18, 156, 255, 0, 254, 169, 18, 152, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 169, 18, 155, 255, 0, 254, 179, 17, 161, 147, 24, 135, 112, 32, 105, 90, 36, 87, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 90, 36, 87, 112, 32, 105, 147, 24, 135, 179, 17, 161, 255, 0, 254, 169, 18, 155, 126, 28, 116, 83, 38, 79, 54, 42, 54, 54, 42, 54, 83, 38, 79, 126, 28, 116, 171, 18, 156, 255, 0, 254, 190, 14, 174, 169, 18, 155, 145, 24, 136, 130, 27, 120, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 130, 27, 120, 145, 24, 136, 169, 18, 155, 190, 14, 174, 255, 0, 254, 171, 18, 156, 126, 28, 116, 83, 38, 79, 54, 42, 54, 52, 44, 52, 80, 38, 76, 122, 30, 112, 167, 19, 153, 255, 0, 254, 201, 12, 180, 190, 14, 171, 179, 17, 161, 171, 18, 154, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 171, 18, 154, 179, 17, 161, 190, 14, 171, 201, 12, 180, 255, 0, 254, 167, 19, 153, 122, 30, 112, 80, 38, 76, 52, 44, 52, 52, 44, 52, 71, 41, 67, 109, 32, 102, 155, 22, 143, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 255, 0, 254, 155, 22, 143, 109, 32, 102, 71, 41, 67, 52, 44, 52, 48, 44, 48, 62, 42, 58, 89, 37, 81, 122, 30, 112, 155, 22, 143, 167, 19, 153, 171, 18, 154, 169, 18, 155, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 167, 19, 153, 169, 18, 155, 171, 18, 154, 167, 19, 153, 155, 22, 143, 122, 30, 112, 89, 37, 81, 62, 42, 58, 48, 44, 48, 48, 44, 48, 53, 45, 53, 68, 41, 64, 89, 37, 81, 109, 32, 102, 122, 30, 112, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 126, 28, 116, 122, 30, 112, 109, 32, 102, 89, 37, 81, 68, 41, 64, 53, 45, 53, 48, 44, 48, 45, 45, 45, 49, 45, 49, 53, 45, 53, 62, 42, 58, 71, 41, 67, 77, 39, 73, 83, 38, 75, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 79, 83, 38, 75, 77, 39, 73, 71, 41, 67, 62, 42, 58, 53, 45, 53, 49, 45, 49, 45, 45, 45, 45, 45, 45, 45, 45, 45, 48, 44, 44, 48, 44, 48, 52, 44, 52, 52, 44, 52, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 54, 42, 54, 52, 44, 52, 52, 44, 52, 48, 44, 48, 48, 44, 44, 45, 45, 45, 45, 45, 45, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 126, 81, 0, 126, 81, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 97, 59, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 97, 59, 0, 97, 59, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 0, 0, 0, 97, 59, 0, 97, 59, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 162, 116, 0, 97, 59, 0, 97, 59, 0, 0, 0, 0, 0, 0, 0, 97, 59, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 0, 0, 0, 97, 59, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 97, 59, 0, 97, 59, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 0, 0, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 82, 64, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 82, 64, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 82, 64, 0, 82, 64, 0, 162, 116, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 82, 64, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 97, 59, 0, 0, 0, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 82, 64, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 82, 64, 0, 82, 64, 0, 162, 116, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 97, 59, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 97, 59, 0, 0, 0, 0, 97, 59, 0, 97, 59, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 97, 59, 0, 0, 0, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 97, 59, 0, 97, 59, 0, 0, 0, 0, 162, 116, 0, 97, 59, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 0, 0, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 97, 59, 0, 97, 59, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 0, 0, 0, 162, 116, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 0, 0, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 0, 0, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 162, 116, 0, 0, 0, 0, 162, 116, 0, 0, 0, 0, 0, 0, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 162, 116, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 146, 97, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 162, 116, 0, 0, 0, 0, 162, 116, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 97, 59, 0, 97, 59, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 41, 43, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 162, 116, 0, 97, 59, 0, 97, 59, 0, 97, 59, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 0, 0, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 97, 59, 0, 97, 59, 0, 162, 116, 0, 0, 0, 0, 162, 116, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 0, 0, 0, 146, 97, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 82, 64, 0, 162, 116, 0, 162, 116, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 0, 0, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 0, 0, 0, 146, 97, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 146, 97, 0, 146, 97, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 146, 97, 0, 0, 0, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 126, 81, 0, 126, 81, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 82, 64, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 82, 64, 0, 82, 64, 0, 146, 97, 0, 146, 97, 0, 146, 97, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 82, 64, 0, 0, 0, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 41, 43, 0, 0, 0, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 162, 116, 0, 0, 0, 0, 41, 43, 0, 0, 0, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 126, 81, 0, 0, 0, 0, 82, 64, 0, 16, 41, 60, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 16, 41, 60, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 16, 41, 60, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 16, 41, 60, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 16, 41, 60, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 16, 41, 60, 45, 122, 143, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 45, 122, 143, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 45, 122, 143, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 45, 122, 143, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 45, 122, 143, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 16, 41, 60, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 45, 122, 143, 118, 185, 214, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 16, 41, 60, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 16, 41, 60, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 118, 185, 214, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 45, 122, 143, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 118, 185, 214, 16, 41, 60, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 55, 144, 177, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 16, 41, 60, 255, 251, 226, 228, 225, 199, 193, 189, 154, 154, 150, 118, 134, 133, 104, 127, 126, 102, 123, 122, 102, 115, 115, 102, 106, 111, 102, 92, 97, 102, 79, 85, 102, 67, 77, 102, 61, 71, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 61, 71, 102, 64, 74, 102, 73, 80, 102, 81, 87, 102, 93, 98, 104, 117, 122, 118, 165, 164, 154, 213, 212, 199, 233, 232, 221, 241, 238, 221, 255, 247, 191, 235, 197, 121, 224, 171, 73, 218, 157, 54, 216, 150, 51, 212, 145, 51, 208, 135, 51, 202, 121, 51, 193, 100, 51, 180, 75, 51, 171, 55, 51, 165, 45, 51, 162, 38, 51, 162, 38, 51, 162, 38, 51, 162, 38, 51, 162, 38, 51, 162, 38, 51, 162, 38, 51, 162, 38, 51, 162, 38, 51, 163, 41, 51, 166, 45, 51, 172, 58, 51, 181, 76, 51, 190, 98, 51, 198, 113, 54, 208, 135, 73, 225, 177, 121, 242, 219, 180, 255, 251, 226, 216, 211, 176, 255, 242, 148, 255, 241, 150, 213, 201, 112, 255, 242, 96, 255, 237, 125, 255, 237, 125, 189, 179, 102, 255, 241, 154, 167, 167, 136, 115, 117, 102, 84, 93, 102, 67, 77, 102, 61, 71, 102, 58, 68, 102, 228, 166, 114, 228, 166, 114, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 90, 105, 136, 93, 107, 136, 106, 117, 136, 98, 103, 102, 129, 128, 102, 159, 155, 102, 239, 190, 68, 188, 179, 112, 202, 196, 131, 255, 242, 148, 222, 218, 176, 164, 163, 127, 223, 166, 76, 201, 190, 112, 255, 237, 127, 246, 215, 67, 210, 198, 102, 204, 193, 102, 255, 237, 125, 190, 187, 136, 255, 241, 154, 121, 122, 103, 135, 97, 103, 164, 82, 104, 198, 74, 104, 228, 71, 104, 254, 167, 116, 254, 167, 116, 228, 71, 104, 197, 71, 104, 158, 70, 104, 111, 69, 103, 91, 106, 136, 98, 113, 136, 115, 125, 136, 120, 122, 102, 162, 155, 102, 255, 237, 125, 255, 242, 95, 255, 237, 127, 215, 201, 112, 255, 237, 102, 194, 187, 127, 116, 118, 106, 205, 128, 54, 239, 192, 68, 255, 242, 95, 245, 211, 67, 245, 210, 67, 243, 203, 67, 219, 156, 51, 157, 151, 102, 175, 134, 103, 207, 111, 105, 255, 93, 107, 255, 83, 109, 255, 82, 111, 255, 172, 123, 255, 72, 80, 255, 72, 80, 255, 215, 175, 255, 79, 111, 255, 78, 110, 255, 75, 107, 194, 75, 106, 134, 82, 104, 93, 98, 103, 194, 105, 51, 237, 185, 67, 255, 242, 95, 245, 209, 67, 246, 213, 67, 255, 242, 96, 227, 175, 54, 165, 158, 106, 84, 90, 102, 188, 92, 51, 146, 144, 102, 179, 170, 102, 255, 242, 95, 255, 235, 81, 255, 235, 81, 217, 139, 52, 201, 133, 104, 251, 116, 106, 255, 102, 112, 255, 98, 117, 255, 180, 133, 255, 181, 137, 255, 94, 101, 255, 77, 88, 255, 77, 88, 255, 94, 101, 255, 219, 184, 255, 218, 182, 255, 88, 118, 255, 84, 113, 250, 86, 107, 184, 101, 104, 201, 104, 52, 255, 235, 81, 219, 156, 51, 242, 201, 67, 203, 190, 102, 255, 237, 125, 221, 161, 51, 144, 142, 102, 67, 77, 102, 174, 64, 51, 108, 113, 102, 138, 134, 102, 234, 178, 67, 209, 137, 51, 214, 127, 52, 235, 107, 54, 255, 111, 109, 255, 104, 116, 255, 109, 126, 255, 114, 137, 255, 194, 156, 255, 197, 163, 255, 130, 136, 255, 119, 127, 255, 119, 127, 255, 130, 136, 255, 227, 199, 255, 225, 196, 255, 113, 139, 255, 102, 127, 255, 95, 117, 255, 97, 109, 232, 86, 55, 207, 109, 52, 206, 128, 52, 238, 188, 67, 188, 179, 102, 255, 237, 125, 215, 149, 51, 129, 130, 102, 61, 71, 102, 166, 48, 51, 81, 87, 102, 98, 103, 102, 188, 92, 51, 198, 96, 52, 233, 91, 54, 255, 80, 61, 255, 103, 119, 255, 112, 133, 255, 196, 159, 255, 204, 175, 255, 161, 166, 255, 173, 177, 255, 171, 176, 255, 180, 184, 255, 180, 184, 255, 171, 176, 255, 173, 177, 255, 161, 166, 255, 231, 207, 255, 128, 151, 255, 110, 134, 255, 101, 119, 255, 71, 61, 232, 86, 55, 201, 102, 52, 205, 127, 51, 172, 165, 102, 255, 237, 125, 206, 130, 51, 115, 117, 102, 58, 68, 102, 163, 41, 51, 67, 74, 102, 73, 83, 102, 172, 62, 52, 219, 64, 54, 255, 69, 61, 255, 76, 74, 255, 116, 136, 255, 139, 158, 255, 211, 186, 255, 222, 203, 255, 201, 204, 255, 212, 214, 255, 213, 216, 255, 219, 221, 255, 219, 221, 255, 213, 216, 255, 212, 214, 255, 201, 204, 255, 239, 224, 255, 163, 180, 255, 139, 158, 255, 113, 136, 255, 74, 75, 255, 71, 61, 223, 85, 54, 195, 106, 52, 255, 237, 125, 154, 149, 102, 194, 105, 51, 98, 101, 102, 58, 68, 102, 162, 38, 51, 93, 105, 136, 93, 107, 136, 130, 76, 104, 250, 81, 108, 255, 92, 117, 255, 111, 134, 255, 198, 165, 255, 214, 190, 255, 194, 196, 255, 215, 217, 255, 227, 229, 255, 235, 237, 255, 240, 241, 255, 241, 242, 255, 241, 242, 255, 240, 241, 255, 235, 237, 255, 227, 229, 255, 215, 217, 255, 242, 228, 255, 235, 216, 255, 228, 201, 255, 111, 134, 255, 94, 116, 250, 94, 107, 154, 108, 103, 140, 146, 136, 138, 144, 136, 181, 79, 51, 79, 88, 102, 58, 68, 102, 162, 38, 51, 90, 105, 136, 91, 106, 136, 193, 72, 106, 255, 81, 113, 255, 100, 128, 255, 128, 151, 255, 211, 186, 255, 227, 211, 255, 219, 221, 255, 236, 237, 255, 244, 245, 255, 249, 249, 255, 251, 251, 255, 252, 252, 255, 252, 252, 255, 251, 251, 255, 249, 249, 255, 244, 245, 255, 236, 237, 255, 247, 239, 255, 242, 228, 255, 234, 213, 255, 128, 151, 255, 102, 127, 255, 92, 112, 199, 91, 105, 118, 128, 136, 115, 125, 136, 171, 58, 51, 67, 77, 102, 58, 68, 102, 162, 38, 51, 58, 68, 102, 111, 69, 103, 255, 75, 107, 255, 88, 118, 255, 113, 139, 255, 204, 175, 255, 183, 186, 255, 215, 217, 255, 234, 235, 255, 246, 247, 255, 252, 252, 255, 254, 254, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 254, 254, 255, 254, 254, 255, 252, 252, 255, 246, 247, 255, 236, 237, 255, 215, 217, 255, 183, 186, 255, 231, 207, 255, 115, 138, 255, 90, 118, 255, 80, 107, 121, 78, 103, 67, 77, 102, 165, 45, 51, 61, 71, 102, 58, 68, 102, 162, 38, 51, 58, 68, 102, 158, 70, 104, 255, 78, 110, 255, 94, 124, 255, 124, 148, 255, 212, 188, 255, 201, 204, 255, 230, 231, 255, 244, 245, 255, 252, 252, 255, 254, 254, 255, 255, 255, 254, 255, 254, 255, 255, 255, 255, 255, 255, 254, 255, 254, 255, 255, 255, 255, 254, 254, 255, 252, 252, 255, 245, 245, 255, 230, 231, 255, 201, 204, 255, 234, 214, 255, 124, 148, 255, 94, 124, 255, 80, 110, 159, 73, 104, 61, 71, 102, 162, 38, 51, 58, 68, 102, 58, 68, 102, 162, 38, 51, 58, 68, 102, 197, 71, 104, 255, 79, 111, 255, 180, 137, 255, 197, 163, 255, 173, 177, 255, 207, 210, 255, 235, 237, 255, 250, 250, 255, 254, 254, 255, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 254, 255, 255, 254, 255, 255, 255, 254, 255, 255, 255, 255, 255, 255, 254, 254, 255, 249, 249, 255, 235, 237, 255, 207, 210, 255, 173, 177, 255, 227, 199, 255, 219, 184, 255, 79, 111, 197, 71, 104, 58, 68, 102, 162, 38, 51, 58, 68, 102, 58, 68, 102, 162, 38, 51, 58, 68, 102, 228, 71, 104, 255, 80, 112, 255, 181, 138, 255, 198, 165, 255, 178, 182, 255, 213, 216, 255, 239, 240, 255, 251, 251, 255, 255, 255, 254, 255, 255, 252, 255, 254, 255, 255, 254, 255, 255, 254, 255, 255, 254, 255, 255, 254, 252, 255, 254, 254, 255, 255, 255, 255, 255, 255, 251, 251, 255, 239, 240, 255, 213, 216, 255, 178, 182, 255, 228, 201, 255, 219, 185, 255, 80, 112, 228, 71, 104, 58, 68, 102, 162, 38, 51, 58, 68, 102, 58, 68, 102, 162, 38, 51, 58, 68, 102, 248, 71, 104, 255, 172, 123, 255, 94, 102, 255, 132, 138, 255, 172, 177, 255, 219, 221, 255, 242, 243, 255, 252, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 217, 255, 254, 217, 255, 254, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 252, 255, 242, 243, 255, 219, 221, 255, 172, 177, 255, 132, 138, 255, 94, 102, 255, 215, 176, 248, 71, 104, 58, 68, 102, 162, 38, 51, 58, 68, 102, 58, 68, 102, 162, 38, 51, 228, 166, 114, 254, 167, 116, 255, 72, 80, 255, 77, 88, 255, 119, 127, 255, 180, 184, 255, 219, 221, 255, 242, 243, 255, 254, 252, 255, 255, 255, 255, 255, 255, 255, 255, 254, 236, 255, 254, 225, 255, 254, 225, 255, 254, 236, 255, 254, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 252, 252, 255, 242, 243, 255, 219, 221, 255, 180, 184, 255, 119, 127, 255, 77, 88, 255, 72, 80, 254, 213, 171, 234, 212, 170, 162, 38, 51, 58, 68, 102, 58, 68, 102, 162, 38, 51, 228, 166, 114, 251, 167, 116, 255, 71, 80, 255, 75, 86, 255, 117, 125, 255, 178, 182, 255, 217, 219, 255, 240, 241, 255, 253, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 241, 255, 254, 241, 255, 254, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 251, 255, 240, 241, 255, 217, 219, 255, 178, 182, 255, 117, 125, 255, 75, 86, 255, 71, 80, 252, 213, 171, 234, 212, 170, 162, 38, 51, 58, 68, 102, 58, 68, 102, 162, 38, 51, 61, 71, 102, 198, 74, 104, 255, 215, 175, 255, 91, 98, 255, 127, 133, 255, 164, 169, 255, 212, 214, 255, 237, 238, 255, 250, 250, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 254, 251, 255, 255, 251, 255, 255, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 254, 254, 255, 250, 250, 255, 237, 238, 255, 212, 214, 255, 164, 169, 255, 127, 133, 255, 91, 98, 255, 171, 122, 197, 71, 104, 58, 68, 102, 162, 38, 51, 58, 68, 102, 61, 71, 102, 165, 45, 51, 67, 77, 102, 164, 79, 104, 255, 83, 109, 255, 219, 182, 255, 225, 195, 255, 161, 166, 255, 195, 199, 255, 227, 229, 255, 245, 245, 255, 252, 252, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 255, 252, 252, 255, 244, 245, 255, 227, 229, 255, 195, 199, 255, 161, 166, 255, 193, 157, 255, 180, 133, 255, 80, 110, 159, 73, 104, 61, 71, 102, 162, 38, 51, 58, 68, 102, 67, 77, 102, 171, 58, 51, 87, 93, 102, 135, 97, 103, 255, 94, 107, 255, 219, 178, 255, 223, 190, 255, 144, 149, 255, 175, 180, 255, 211, 213, 255, 236, 237, 255, 247, 248, 255, 252, 252, 255, 254, 254, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 254, 255, 254, 254, 255, 252, 252, 255, 247, 248, 255, 234, 235, 255, 211, 213, 255, 175, 180, 255, 145, 147, 255, 189, 147, 255, 179, 128, 255, 89, 107, 125, 84, 103, 73, 80, 102, 166, 45, 51, 61, 71, 102, 81, 87, 102, 181, 79, 51, 115, 117, 102, 118, 117, 103, 206, 106, 105, 255, 99, 112, 255, 107, 127, 255, 226, 197, 255, 159, 163, 255, 194, 196, 255, 215, 217, 255, 234, 235, 255, 245, 245, 255, 250, 250, 255, 251, 251, 255, 254, 252, 255, 254, 252, 255, 251, 251, 255, 250, 250, 255, 245, 245, 255, 234, 235, 255, 219, 221, 255, 194, 196, 255, 159, 163, 255, 195, 158, 255, 109, 126, 255, 105, 111, 206, 106, 105, 104, 108, 103, 95, 100, 102, 173, 60, 51, 67, 77, 102, 100, 105, 102, 196, 108, 51, 167, 167, 136, 255, 241, 154, 166, 123, 103, 250, 101, 107, 255, 97, 116, 255, 111, 134, 255, 228, 201, 255, 235, 216, 255, 194, 196, 255, 215, 217, 255, 227, 229, 255, 235, 237, 255, 240, 241, 255, 241, 242, 255, 241, 242, 255, 240, 241, 255, 235, 237, 255, 227, 229, 255, 215, 217, 255, 227, 211, 255, 214, 190, 255, 200, 165, 255, 115, 133, 255, 107, 116, 251, 116, 106, 174, 132, 103, 158, 159, 136, 150, 153, 136, 183, 84, 51, 81, 87, 102, 123, 124, 102, 208, 135, 51, 255, 241, 154, 175, 173, 136, 125, 127, 103, 184, 101, 104, 255, 89, 110, 255, 94, 121, 255, 222, 190, 255, 228, 201, 255, 159, 163, 255, 183, 186, 255, 195, 199, 255, 207, 210, 255, 217, 219, 255, 219, 221, 255, 219, 221, 255, 217, 219, 255, 207, 210, 255, 195, 199, 255, 183, 186, 255, 211, 186, 255, 200, 165, 255, 189, 146, 255, 101, 119, 255, 109, 109, 200, 130, 104, 255, 237, 125, 255, 241, 154, 179, 177, 136, 197, 110, 51, 98, 101, 102, 139, 138, 102, 216, 151, 51, 255, 237, 125, 162, 157, 102, 193, 105, 51, 188, 72, 53, 227, 53, 56, 255, 54, 63, 255, 94, 121, 255, 111, 134, 255, 226, 197, 255, 231, 207, 255, 161, 166, 255, 173, 177, 255, 171, 176, 255, 180, 184, 255, 180, 184, 255, 171, 176, 255, 173, 177, 255, 161, 166, 255, 205, 174, 255, 129, 149, 255, 115, 133, 255, 101, 119, 255, 69, 61, 231, 83, 55, 204, 109, 52, 212, 145, 51, 185, 177, 102, 255, 237, 125, 205, 129, 51, 111, 113, 102, 151, 147, 102, 255, 235, 81, 186, 177, 102, 162, 157, 102, 229, 160, 67, 181, 80, 52, 188, 59, 53, 227, 57, 56, 255, 89, 110, 255, 97, 116, 255, 107, 127, 255, 114, 137, 255, 225, 195, 255, 227, 199, 255, 130, 136, 255, 119, 127, 255, 119, 127, 255, 130, 136, 255, 197, 163, 255, 193, 157, 255, 114, 137, 255, 109, 126, 255, 104, 116, 255, 106, 109, 231, 83, 55, 200, 94, 52, 199, 115, 52, 237, 186, 67, 189, 179, 102, 255, 237, 125, 208, 135, 51, 113, 115, 102, 155, 152, 102, 255, 235, 81, 193, 182, 102, 172, 165, 102, 232, 171, 67, 191, 100, 51, 185, 88, 52, 192, 83, 53, 187, 106, 104, 250, 104, 107, 255, 99, 112, 255, 98, 117, 255, 219, 182, 255, 219, 184, 255, 94, 101, 255, 77, 88, 255, 77, 88, 255, 94, 101, 255, 181, 137, 255, 180, 133, 255, 93, 118, 255, 100, 112, 251, 109, 107, 196, 124, 104, 204, 109, 52, 200, 117, 52, 206, 130, 51, 239, 191, 67, 255, 237, 125, 189, 179, 102, 208, 135, 51, 115, 117, 102, 162, 157, 106, 226, 172, 54, 255, 242, 96, 241, 200, 67, 238, 189, 67, 235, 180, 67, 233, 172, 67, 200, 119, 51, 134, 133, 103, 168, 123, 103, 206, 106, 105, 255, 94, 107, 255, 83, 109, 255, 82, 111, 255, 215, 175, 255, 72, 80, 255, 72, 80, 255, 172, 123, 255, 79, 111, 255, 80, 110, 255, 86, 107, 203, 97, 105, 165, 121, 103, 255, 237, 125, 210, 137, 51, 237, 185, 67, 238, 189, 67, 241, 196, 67, 255, 242, 95, 243, 203, 68, 212, 142, 54, 126, 127, 106, 186, 179, 127, 233, 188, 76, 255, 239, 133, 204, 192, 104, 242, 202, 67, 255, 237, 125, 179, 171, 102, 175, 168, 102, 181, 179, 136, 255, 241, 154, 118, 120, 103, 135, 94, 103, 164, 82, 104, 198, 74, 104, 228, 71, 104, 254, 167, 116, 254, 167, 116, 228, 71, 104, 197, 71, 104, 159, 73, 104, 118, 78, 103, 116, 126, 136, 139, 145, 136, 167, 167, 136, 255, 237, 125, 255, 237, 125, 189, 178, 102, 243, 203, 67, 206, 193, 104, 255, 239, 133, 223, 169, 76, 166, 163, 127, 226, 221, 179, 255, 242, 149, 219, 209, 133, 255, 239, 133, 255, 242, 96, 193, 182, 102, 255, 237, 125, 255, 237, 125, 255, 241, 154, 168, 169, 136, 115, 117, 102, 87, 93, 102, 67, 77, 102, 61, 71, 102, 58, 68, 102, 228, 166, 114, 228, 166, 114, 58, 68, 102, 58, 68, 102, 58, 68, 102, 64, 74, 102, 106, 117, 136, 124, 133, 136, 150, 153, 136, 155, 149, 102, 175, 168, 102, 255, 237, 125, 244, 207, 68, 210, 199, 112, 255, 241, 151, 238, 205, 131, 219, 215, 179, 250, 248, 232, 255, 249, 203, 239, 207, 131, 225, 172, 76, 216, 152, 54, 211, 143, 51, 211, 140, 51, 210, 139, 51, 205, 127, 51, 194, 105, 51, 181, 79, 51, 171, 55, 51, 165, 45, 51, 162, 38, 51, 162, 38, 51, 162, 38, 51, 162, 38, 51, 162, 38, 51, 162, 38, 51, 162, 38, 51, 163, 41, 51, 166, 48, 51, 173, 60, 51, 182, 81, 51, 194, 105, 51, 205, 128, 51, 216, 149, 51, 255, 235, 84, 255, 237, 102, 242, 213, 131, 255, 249, 203, 250, 248, 232, 255, 254, 251, 250, 248, 232, 219, 215, 179, 168, 163, 127, 134, 133, 106, 123, 124, 102, 123, 124, 102, 120, 122, 102, 113, 115, 102, 98, 101, 102, 79, 88, 102, 67, 77, 102, 61, 71, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 58, 68, 102, 61, 71, 102, 67, 77, 102, 77, 86, 102, 92, 97, 102, 113, 115, 102, 135, 134, 102, 158, 154, 106, 188, 181, 127, 226, 221, 179, 250, 248, 232, 255, 254, 251};
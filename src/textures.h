@@ -1,6 +0,0 @@
-#pragma once
-
-#define TEX_WIDTH 32
-#define TEX_HEIGHT 32
-
-extern int all_textures[3 * 32 * 32 * 21];
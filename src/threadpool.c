@@ -0,0 +1,179 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "threadpool.h"
+
+#define CACHE_LINE 64
+
+// One per worker, each on its own cache line so the owner and thieves
+// bumping different counters never contend.
+typedef struct {
+    _Alignas(CACHE_LINE) atomic_int next;
+    int end;
+} pool_queue_t;
+
+typedef struct {
+    threadpool_t *pool;
+    int id;
+} worker_arg_t;
+
+struct threadpool {
+    int threads;
+    pthread_t *workers;
+    worker_arg_t *args;
+    pool_queue_t *queues;
+
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_cond_t done;
+    unsigned generation;
+    int pending;
+    int shutdown;
+
+    // current job, written under lock before the generation bump
+    pool_fn fn;
+    void *ctx;
+    int count;
+    int grain;
+};
+
+static void run_queue(threadpool_t *pool, pool_queue_t *queue, int worker) {
+    int tile;
+    while((tile = atomic_fetch_add_explicit(&queue->next, 1, memory_order_relaxed)) < queue->end) {
+        int begin = tile * pool->grain;
+        int end = begin + pool->grain;
+        if(end > pool->count) end = pool->count;
+        pool->fn(pool->ctx, begin, end, worker);
+    }
+}
+
+static void do_work(threadpool_t *pool, int worker) {
+    run_queue(pool, &pool->queues[worker], worker);
+
+    // own share is done, steal from the others
+    for(int i = 1; i < pool->threads; i++) {
+        run_queue(pool, &pool->queues[(worker + i) % pool->threads], worker);
+    }
+}
+
+static void *worker_main(void *data) {
+    worker_arg_t *arg = data;
+    threadpool_t *pool = arg->pool;
+    unsigned seen = 0;
+
+    while(1) {
+        pthread_mutex_lock(&pool->lock);
+        while(pool->generation == seen && !pool->shutdown) {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        if(pool->shutdown) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        do_work(pool, arg->id);
+
+        pthread_mutex_lock(&pool->lock);
+        if(--pool->pending == 0) pthread_cond_signal(&pool->done);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+threadpool_t *threadpool_create(int threads) {
+    if(threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if(threads <= 0) threads = 1;
+
+    threadpool_t *pool = calloc(1, sizeof(threadpool_t));
+    if(!pool) return NULL;
+
+    pool->threads = threads;
+    pool->queues = aligned_alloc(CACHE_LINE, threads * sizeof(pool_queue_t));
+    pool->workers = calloc(threads, sizeof(pthread_t));
+    pool->args = calloc(threads, sizeof(worker_arg_t));
+    if(!pool->queues || !pool->workers || !pool->args) {
+        printf("Failed to allocate thread pool\n");
+        free(pool->queues);
+        free(pool->workers);
+        free(pool->args);
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    // worker 0 is the calling thread
+    for(int i = 1; i < threads; i++) {
+        pool->args[i].pool = pool;
+        pool->args[i].id = i;
+        if(pthread_create(&pool->workers[i], NULL, worker_main, &pool->args[i]) != 0) {
+            printf("Failed to start worker thread %d, continuing with %d\n", i, i);
+            pool->threads = i;
+            break;
+        }
+    }
+    return pool;
+}
+
+void threadpool_destroy(threadpool_t *pool) {
+    if(!pool) return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for(int i = 1; i < pool->threads; i++) pthread_join(pool->workers[i], NULL);
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->wake);
+    pthread_cond_destroy(&pool->done);
+    free(pool->queues);
+    free(pool->workers);
+    free(pool->args);
+    free(pool);
+}
+
+int threadpool_size(const threadpool_t *pool) {
+    return pool->threads;
+}
+
+void threadpool_run(threadpool_t *pool, int count, int grain, pool_fn fn, void *ctx) {
+    if(count <= 0) return;
+    if(grain < 1) grain = 1;
+
+    int tiles = (count + grain - 1) / grain;
+    if(pool->threads == 1 || tiles == 1) {
+        fn(ctx, 0, count, 0);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->fn = fn;
+    pool->ctx = ctx;
+    pool->count = count;
+    pool->grain = grain;
+
+    // contiguous shares keep neighbouring tiles on the same core
+    for(int i = 0; i < pool->threads; i++) {
+        atomic_store_explicit(&pool->queues[i].next, (int)((long)tiles * i / pool->threads), memory_order_relaxed);
+        pool->queues[i].end = (int)((long)tiles * (i + 1) / pool->threads);
+    }
+
+    pool->pending = pool->threads - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    do_work(pool, 0);
+
+    pthread_mutex_lock(&pool->lock);
+    while(pool->pending > 0) pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
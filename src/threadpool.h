@@ -0,0 +1,19 @@
+#pragma once
+
+// Persistent pool of worker threads for data-parallel loops. The caller
+// takes part as worker 0, so a pool of one thread runs everything inline.
+typedef struct threadpool threadpool_t;
+
+// Called with a half-open range [begin, end) of items and the index of
+// the worker running it (0 .. threadpool_size()-1).
+typedef void (*pool_fn)(void *ctx, int begin, int end, int worker);
+
+// threads <= 0 uses one thread per online CPU.
+threadpool_t *threadpool_create(int threads);
+void threadpool_destroy(threadpool_t *pool);
+int threadpool_size(const threadpool_t *pool);
+
+// Splits [0, count) into tiles of `grain` items, hands each worker an equal
+// share of tiles and lets idle workers steal from the others. Returns once
+// every tile has run.
+void threadpool_run(threadpool_t *pool, int count, int grain, pool_fn fn, void *ctx);
@@ -0,0 +1,118 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "trace.h"
+
+void trace_init(trace_t *trace) {
+    memset(trace, 0, sizeof(trace_t));
+}
+
+void trace_free(trace_t *trace) {
+    free(trace->events);
+    trace_init(trace);
+}
+
+static int append(trace_t *trace, double time, const input_t *input) {
+    if(trace->count == trace->capacity) {
+        int capacity = trace->capacity ? trace->capacity * 2 : 64;
+        trace_event_t *events = realloc(trace->events, capacity * sizeof(trace_event_t));
+        if(!events) {
+            printf("Failed to grow input trace\n");
+            return -1;
+        }
+        trace->events = events;
+        trace->capacity = capacity;
+    }
+
+    trace->events[trace->count].time = time;
+    trace->events[trace->count].input = *input;
+    trace->count++;
+    return 0;
+}
+
+int trace_record(trace_t *trace, double time, const input_t *input) {
+    if(trace->count > 0 && memcmp(&trace->events[trace->count - 1].input, input, sizeof(input_t)) == 0) return 0;
+    return append(trace, time, input);
+}
+
+int trace_end(trace_t *trace, double time) {
+    input_t input = { 0 };
+    if(trace->count > 0) input = trace->events[trace->count - 1].input;
+    return append(trace, time, &input);
+}
+
+int trace_load(trace_t *trace, const char *path) {
+    trace_init(trace);
+
+    FILE *file = fopen(path, "r");
+    if(!file) {
+        printf("Failed to open trace %s\n", path);
+        return -1;
+    }
+
+    char line[256];
+    int number = 0;
+    while(fgets(line, sizeof(line), file)) {
+        number++;
+        if(line[0] == '#' || line[0] == '\n') continue;
+
+        double time;
+        input_t input;
+        if(sscanf(line, "%lf %d %d %d %d", &time, &input.forward, &input.backward, &input.left, &input.right) != 5 ||
+           (trace->count > 0 && time < trace->events[trace->count - 1].time)) {
+            printf("Trace %s: bad event on line %d\n", path, number);
+            fclose(file);
+            trace_free(trace);
+            return -1;
+        }
+        if(append(trace, time, &input) < 0) {
+            fclose(file);
+            trace_free(trace);
+            return -1;
+        }
+    }
+
+    fclose(file);
+    return 0;
+}
+
+int trace_save(const trace_t *trace, const char *path) {
+    FILE *file = fopen(path, "w");
+    if(!file) {
+        printf("Failed to create trace %s\n", path);
+        return -1;
+    }
+
+    fprintf(file, "# time forward backward left right\n");
+    for(int i = 0; i < trace->count; i++) {
+        const trace_event_t *event = &trace->events[i];
+        fprintf(file, "%.6f %d %d %d %d\n", event->time, event->input.forward, event->input.backward,
+            event->input.left, event->input.right);
+    }
+
+    if(fclose(file) != 0) {
+        printf("Failed to write trace %s\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+void trace_input(const trace_t *trace, double time, input_t *input) {
+    memset(input, 0, sizeof(input_t));
+    if(trace->count == 0) return;
+
+    double length = trace->events[trace->count - 1].time;
+    if(length > 0) time = fmod(time, length);
+
+    // binary search for the last event at or before time
+    int low = 0, high = trace->count - 1;
+    if(time < trace->events[0].time) return;
+    while(low < high) {
+        int mid = (low + high + 1) / 2;
+        if(trace->events[mid].time <= time) low = mid;
+        else high = mid - 1;
+    }
+    *input = trace->events[low].input;
+}
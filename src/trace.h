@@ -0,0 +1,32 @@
+#pragma once
+
+#include "player.h"
+
+// Recorded input: the key state after each change, stamped with seconds
+// since the start of the run. Stored as text, one event per line:
+//   <time> <forward> <backward> <left> <right>
+typedef struct {
+    double time;
+    input_t input;
+} trace_event_t;
+
+typedef struct {
+    int count;
+    int capacity;
+    trace_event_t *events;
+} trace_t;
+
+void trace_init(trace_t *trace);
+void trace_free(trace_t *trace);
+
+// Appends an event when the key state differs from the last one.
+int trace_record(trace_t *trace, double time, const input_t *input);
+// Marks the end of the recording, the length replays loop over.
+int trace_end(trace_t *trace, double time);
+
+int trace_load(trace_t *trace, const char *path);
+int trace_save(const trace_t *trace, const char *path);
+
+// Key state held at the given time. Playback loops at the time of the last
+// event, so a short recording can drive a run of any length.
+void trace_input(const trace_t *trace, double time, input_t *input);
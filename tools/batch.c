@@ -0,0 +1,534 @@
+// Offline renderer. Renders a camera path through a map with no window or
+// GL, spreading the frames over the thread pool, to numbered PNG or PPM
+// files or one raw RGB stream. Each frame's checksum is printed or saved,
+// so a run can be kept as golden output and compared against later.
+//
+//   batch -g 64 -c path.txt -o frames/%04d.png
+//   batch -i hehe.trace -r 640x400 -o - | ffmpeg -f rawvideo -pixel_format rgb24 -video_size 640x400 -i - out.mp4
+//   batch -i hehe.trace -G golden.txt
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "atlas.h"
+#include "map.h"
+#include "player.h"
+#include "render.h"
+#include "sprite.h"
+#include "threadpool.h"
+#include "trace.h"
+#include "utils.h"
+
+enum { OUTPUT_NONE, OUTPUT_PPM, OUTPUT_PNG, OUTPUT_RAW };
+
+// One frame of the batch in flight, packed to RGB for writing.
+typedef struct {
+    int frame;
+    uint32_t checksum;
+    int failed;
+    unsigned char *rgb;
+} slot_t;
+
+typedef struct {
+    renderer_t *renderers;  // one per pool worker
+    const player_t *poses;
+    const map_t *map;
+    const sprites_t *sprites;
+    slot_t *slots;
+    int first;              // frame of slots[0]
+    int format;
+    const char *output;
+} batch_t;
+
+static uint32_t crc_table[256];
+
+static void crc_init(void) {
+    for(uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for(int k = 0; k < 8; k++) c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+        crc_table[n] = c;
+    }
+}
+
+static uint32_t crc_update(uint32_t crc, const unsigned char *data, size_t size) {
+    for(size_t i = 0; i < size; i++) crc = crc_table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    return crc;
+}
+
+static void put_u32(unsigned char *out, uint32_t value) {
+    out[0] = value >> 24;
+    out[1] = value >> 16;
+    out[2] = value >> 8;
+    out[3] = value;
+}
+
+static int write_chunk(FILE *f, const char *type, const unsigned char *data, size_t size) {
+    unsigned char header[8], footer[4];
+    put_u32(header, size);
+    memcpy(header + 4, type, 4);
+    uint32_t crc = crc_update(0xffffffffu, header + 4, 4);
+    crc = crc_update(crc, data, size);
+    put_u32(footer, crc ^ 0xffffffffu);
+    return fwrite(header, 8, 1, f) == 1 && (size == 0 || fwrite(data, size, 1, f) == 1) && fwrite(footer, 4, 1, f) == 1;
+}
+
+// Uncompressed PNG: the image data goes into stored deflate blocks, which
+// any decoder reads, so no zlib is needed and writing costs two checksums.
+static int write_png(const char *path, const unsigned char *rgb, int width, int height) {
+    size_t row_size = (size_t)width * 3 + 1;
+    size_t raw_size = row_size * height;
+    size_t blocks = (raw_size + 65534) / 65535;
+    size_t size = 2 + raw_size + blocks * 5 + 4;
+    unsigned char *data = malloc(size);
+    if(!data) {
+        fprintf(stderr, "Failed to allocate PNG buffer\n");
+        return -1;
+    }
+
+    // zlib header, then each row behind a "no filter" byte
+    unsigned char *out = data;
+    *out++ = 0x78;
+    *out++ = 0x01;
+    uint32_t adler_a = 1, adler_b = 0;
+    size_t left = raw_size, in_block = 0;
+    for(int y = 0; y < height; y++) {
+        for(size_t i = 0; i < row_size; i++) {
+            if(in_block == 0) {
+                in_block = left < 65535 ? left : 65535;
+                *out++ = left == in_block;
+                *out++ = in_block & 0xff;
+                *out++ = in_block >> 8;
+                *out++ = ~in_block & 0xff;
+                *out++ = (~in_block >> 8) & 0xff;
+            }
+            unsigned char byte = i == 0 ? 0 : rgb[(size_t)y * width * 3 + i - 1];
+            *out++ = byte;
+            adler_a = (adler_a + byte) % 65521;
+            adler_b = (adler_b + adler_a) % 65521;
+            in_block--;
+            left--;
+        }
+    }
+    put_u32(out, adler_b << 16 | adler_a);
+
+    unsigned char header[13] = { 0 };
+    put_u32(header, width);
+    put_u32(header + 4, height);
+    header[8] = 8;      // bits per channel
+    header[9] = 2;      // RGB
+
+    FILE *f = fopen(path, "wb");
+    if(!f) {
+        fprintf(stderr, "Failed to open %s\n", path);
+        free(data);
+        return -1;
+    }
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    int ok = fwrite(signature, 8, 1, f) == 1 && write_chunk(f, "IHDR", header, 13) &&
+             write_chunk(f, "IDAT", data, size) && write_chunk(f, "IEND", NULL, 0);
+    ok = fclose(f) == 0 && ok;
+    free(data);
+    if(!ok) fprintf(stderr, "Failed to write %s\n", path);
+    return ok ? 0 : -1;
+}
+
+static int write_ppm(const char *path, const unsigned char *rgb, int width, int height) {
+    FILE *f = fopen(path, "wb");
+    if(!f) {
+        fprintf(stderr, "Failed to open %s\n", path);
+        return -1;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", width, height);
+    int ok = fwrite(rgb, (size_t)width * height * 3, 1, f) == 1;
+    ok = fclose(f) == 0 && ok;
+    if(!ok) fprintf(stderr, "Failed to write %s\n", path);
+    return ok ? 0 : -1;
+}
+
+static void pack_rgb(unsigned char *rgb, const framebuffer_t *fb) {
+    for(int y = 0; y < fb->height; y++) {
+        const unsigned char *row = (const unsigned char *)(fb->pixels + (size_t)y * fb->stride);
+        for(int x = 0; x < fb->width; x++) {
+            *rgb++ = row[x * 4];
+            *rgb++ = row[x * 4 + 1];
+            *rgb++ = row[x * 4 + 2];
+        }
+    }
+}
+
+static void render_batch(void *ctx, int begin, int end, int worker) {
+    batch_t *batch = ctx;
+    renderer_t *r = &batch->renderers[worker];
+
+    for(int i = begin; i < end; i++) {
+        slot_t *slot = &batch->slots[i];
+        slot->frame = batch->first + i;
+        slot->failed = 0;
+
+        render_frame(r, &batch->poses[slot->frame], batch->map, batch->sprites);
+        slot->checksum = framebuffer_checksum(&r->fb);
+        if(batch->format == OUTPUT_NONE) continue;
+
+        pack_rgb(slot->rgb, &r->fb);
+        if(batch->format == OUTPUT_RAW) continue;
+
+        char path[4096];
+        snprintf(path, sizeof(path), batch->output, slot->frame);
+        if(batch->format == OUTPUT_PNG) slot->failed = write_png(path, slot->rgb, r->fb.width, r->fb.height) < 0;
+        else slot->failed = write_ppm(path, slot->rgb, r->fb.width, r->fb.height) < 0;
+    }
+}
+
+// One pose per line, "x y angle" in cells and degrees; # starts a comment.
+static int load_poses(const char *path, const player_t *start, player_t **poses) {
+    FILE *f = fopen(path, "r");
+    if(!f) {
+        fprintf(stderr, "Failed to open %s\n", path);
+        return -1;
+    }
+
+    int count = 0, capacity = 0;
+    *poses = NULL;
+    char line[256];
+    while(fgets(line, sizeof(line), f)) {
+        float x, y, angle;
+        char *comment = strchr(line, '#');
+        if(comment) *comment = 0;
+        int fields = sscanf(line, "%f %f %f", &x, &y, &angle);
+        if(fields <= 0) continue;
+        if(fields != 3) {
+            fprintf(stderr, "Bad pose in %s: %s\n", path, line);
+            free(*poses);
+            *poses = NULL;
+            fclose(f);
+            return -1;
+        }
+
+        if(count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            player_t *grown = realloc(*poses, capacity * sizeof(player_t));
+            if(!grown) {
+                fprintf(stderr, "Failed to allocate poses\n");
+                free(*poses);
+                *poses = NULL;
+                fclose(f);
+                return -1;
+            }
+            *poses = grown;
+        }
+        player_t *pose = &(*poses)[count++];
+        *pose = *start;
+        pose->x = x * BLOCKS_WIDTH;
+        pose->y = y * BLOCKS_HEIGHT;
+        player_set_angle(pose, angle * (M_PI / 180));
+    }
+    fclose(f);
+    return count;
+}
+
+// Replays the trace through handle_movement with a fixed step, like bench.
+static int trace_poses(const trace_t *trace, const map_t *map, const player_t *start, int frames, float d_time, player_t **poses) {
+    *poses = malloc(frames * sizeof(player_t));
+    if(!*poses) {
+        fprintf(stderr, "Failed to allocate poses\n");
+        return -1;
+    }
+
+    player_t player = *start;
+    for(int frame = 0; frame < frames; frame++) {
+        (*poses)[frame] = player;
+        input_t input;
+        trace_input(trace, frame * (double)d_time, &input);
+        handle_movement(&player, &input, map, d_time);
+    }
+    return frames;
+}
+
+// Golden files hold one "frame checksum" line per frame, as written by -k.
+static int compare_golden(const char *path, const uint32_t *checksums, int frames) {
+    FILE *f = fopen(path, "r");
+    if(!f) {
+        fprintf(stderr, "Failed to open %s\n", path);
+        return -1;
+    }
+
+    int differ = 0, seen = 0, frame;
+    unsigned golden;
+    char *found = calloc(frames, 1);
+    while(found && fscanf(f, "%d %x", &frame, &golden) == 2) {
+        if(frame < 0 || frame >= frames) continue;
+        found[frame] = 1;
+        seen++;
+        if(golden != checksums[frame]) {
+            fprintf(stderr, "frame %d: %08x, golden %08x\n", frame, checksums[frame], golden);
+            differ++;
+        }
+    }
+    fclose(f);
+    for(int i = 0; found && i < frames; i++) {
+        if(!found[i]) fprintf(stderr, "frame %d: %08x, not in golden\n", i, checksums[i]);
+    }
+    free(found);
+    differ += frames - seen;
+    fprintf(stderr, "%d of %d frames differ from %s\n", differ, frames, path);
+    return differ ? 1 : 0;
+}
+
+// The image name is used as the snprintf format for the frame number, so
+// it may hold no conversion but a single int one; %% stays allowed.
+// Returns the number of int conversions, or -1 for any other.
+static int frame_conversions(const char *output) {
+    int count = 0;
+    for(const char *c = output; *c; c++) {
+        if(*c != '%') continue;
+        if(*++c == '%') continue;
+        c += strspn(c, "-+ #0");
+        c += strspn(c, "0123456789");
+        if(*c == '.') c += 1 + strspn(c + 1, "0123456789");
+        if(*c != 'd' && *c != 'i') return -1;
+        count++;
+    }
+    return count;
+}
+
+static int output_format(const char *output) {
+    if(!output) return OUTPUT_NONE;
+    size_t length = strlen(output);
+    int format = OUTPUT_RAW;
+    if(length > 4 && strcmp(output + length - 4, ".png") == 0) format = OUTPUT_PNG;
+    if(length > 4 && strcmp(output + length - 4, ".ppm") == 0) format = OUTPUT_PPM;
+    if(format != OUTPUT_RAW && frame_conversions(output) != 1) {
+        fprintf(stderr, "Output %s needs one frame number, like frames/%%04d.png\n", output);
+        return -1;
+    }
+    return format;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "usage: %s (-c poses | -i trace) [options]\n", name);
+    fprintf(stderr, "  -c file       camera path, one \"x y angle\" per line in cells and degrees\n");
+    fprintf(stderr, "  -i trace      input trace recorded with hehe -r, replayed from the map centre\n");
+    fprintf(stderr, "  -n frames     frames to render from a trace (default its length)\n");
+    fprintf(stderr, "  -d seconds    trace time per frame (default 1/60)\n");
+    fprintf(stderr, "  -m map        map file\n");
+    fprintf(stderr, "  -g size       generate a size x size map with random pillars (default 64)\n");
+    fprintf(stderr, "  -r WxH        resolution (default 640x400)\n");
+    fprintf(stderr, "  -f fov        horizontal field of view in degrees, 0-180 (default 60)\n");
+    fprintf(stderr, "  -q level      dynamic resolution level 0-%d (default 0)\n", RENDER_QUALITY_LEVELS - 1);
+    fprintf(stderr, "  -j threads    frames rendered at once, 0 = one per CPU (default)\n");
+    fprintf(stderr, "  -a atlas      wall texture atlas (default glx/textures.atlas)\n");
+    fprintf(stderr, "  -A atlas      sprite texture atlas (default glx/sprites.atlas)\n");
+    fprintf(stderr, "  -S sprites    sprites scattered over the map (default 0)\n");
+    fprintf(stderr, "  -o output     frames/%%04d.png or .ppm for numbered images, anything\n");
+    fprintf(stderr, "                else for one raw RGB stream, - for stdout\n");
+    fprintf(stderr, "  -k file       write the frame checksums to a golden file\n");
+    fprintf(stderr, "  -G file       compare the frame checksums against a golden file\n");
+}
+
+int main(int argc, char **argv) {
+    const char *atlas_path = "glx/textures.atlas";
+    const char *sprite_atlas_path = "glx/sprites.atlas";
+    const char *map_path = NULL;
+    const char *poses_path = NULL;
+    const char *trace_path = NULL;
+    const char *output = NULL;
+    const char *checksum_path = NULL;
+    const char *golden_path = NULL;
+    int map_size = 64;
+    int width = 640, height = 400;
+    float fov = 60;
+    float d_time = 1 / 60.0f;
+    int quality = 0;
+    int threads = 0;
+    int sprite_count = 0;
+    int frames = 0;
+
+    int opt;
+    while((opt = getopt(argc, argv, "c:i:n:d:m:g:r:f:q:j:a:A:S:o:k:G:h")) != -1) {
+        switch(opt) {
+            case 'c': poses_path = optarg; break;
+            case 'i': trace_path = optarg; break;
+            case 'n': frames = atoi(optarg); break;
+            case 'd': d_time = strtof(optarg, NULL); break;
+            case 'm': map_path = optarg; break;
+            case 'g': map_size = atoi(optarg); break;
+            case 'r':
+                if(sscanf(optarg, "%dx%d", &width, &height) != 2 || width <= 0 || height <= 0) {
+                    fprintf(stderr, "Bad resolution %s\n", optarg);
+                    return -1;
+                }
+                break;
+            case 'f':
+                fov = strtof(optarg, NULL);
+                if(!(fov > 0 && fov < 180)) {
+                    fprintf(stderr, "Bad field of view %s\n", optarg);
+                    return -1;
+                }
+                break;
+            case 'q': quality = atoi(optarg); break;
+            case 'j': threads = atoi(optarg); break;
+            case 'a': atlas_path = optarg; break;
+            case 'A': sprite_atlas_path = optarg; break;
+            case 'S': sprite_count = atoi(optarg); break;
+            case 'o': output = optarg; break;
+            case 'k': checksum_path = optarg; break;
+            case 'G': golden_path = optarg; break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : -1;
+        }
+    }
+    if(!poses_path == !trace_path || d_time <= 0) {
+        usage(argv[0]);
+        return -1;
+    }
+    int format = output_format(output);
+    if(format < 0) return -1;
+    // frames streamed to stdout leave it to the images
+    int quiet = format == OUTPUT_RAW && strcmp(output, "-") == 0;
+
+    map_t map;
+    if(map_path ? map_load(&map, map_path) < 0 : map_generate(&map, map_size, map_size, map_size > 8 ? 0.05f : 0, 1) < 0) return -1;
+
+    player_t start = {
+        .x = map.width * BLOCKS_WIDTH / 2,
+        .y = map.height * BLOCKS_HEIGHT / 2,
+        .w = BLOCKS_WIDTH * 8 / 25,
+        .h = BLOCKS_HEIGHT * 8 / 25
+    };
+    player_set_angle(&start, M_PI);
+
+    player_t *poses = NULL;
+    if(poses_path) {
+        frames = load_poses(poses_path, &start, &poses);
+    }
+    else {
+        trace_t trace;
+        if(trace_load(&trace, trace_path) < 0) {
+            map_free(&map);
+            return -1;
+        }
+        if(frames <= 0) frames = trace.count ? (int)ceil(trace.events[trace.count - 1].time / d_time) : 0;
+        frames = trace_poses(&trace, &map, &start, frames, d_time, &poses);
+        trace_free(&trace);
+    }
+    if(frames <= 0) {
+        if(frames == 0) fprintf(stderr, "No frames to render\n");
+        free(poses);
+        map_free(&map);
+        return -1;
+    }
+
+    atlas_t atlas, sprite_atlas;
+    sprites_t sprites;
+    if(atlas_load(&atlas, atlas_path) < 0) {
+        free(poses);
+        map_free(&map);
+        return -1;
+    }
+    if(sprite_count > 0) {
+        if(atlas_load(&sprite_atlas, sprite_atlas_path) < 0) {
+            atlas_free(&atlas);
+            free(poses);
+            map_free(&map);
+            return -1;
+        }
+        if(sprites_init(&sprites, &sprite_atlas, &map, sprite_count) < 0) {
+            atlas_free(&sprite_atlas);
+            atlas_free(&atlas);
+            free(poses);
+            map_free(&map);
+            return -1;
+        }
+        sprites_scatter(&sprites, &map, sprite_count, 0, 1);
+    }
+
+    // the pool spreads frames, each worker renders its frames inline
+    threadpool_t *pool = threadpool_create(threads);
+    int workers = pool ? threadpool_size(pool) : 0;
+    int batch_size = workers * 2;
+    renderer_t *renderers = calloc(workers, sizeof(renderer_t));
+    slot_t *slots = calloc(batch_size, sizeof(slot_t));
+    uint32_t *checksums = malloc(frames * sizeof(uint32_t));
+    FILE *stream = NULL;
+    int ready = 0, result = 0;
+    if(pool && renderers && slots && checksums) {
+        for(; ready < workers; ready++) {
+            if(renderer_init(&renderers[ready], &atlas, width, height, 1) < 0) break;
+            renderers[ready].fov = fov * (M_PI / 180);
+            // frames land on workers in any order, so there is no last
+            // frame worth caching
+            renderers[ready].cache = 0;
+            renderer_set_quality(&renderers[ready], quality);
+        }
+        for(int i = 0; format != OUTPUT_NONE && i < batch_size; i++) {
+            slots[i].rgb = malloc((size_t)width * height * 3);
+            if(!slots[i].rgb) result = -1;
+        }
+    }
+    if(!pool || ready != workers || result < 0) {
+        fprintf(stderr, "Failed to set up %d renderers\n", workers);
+        result = -1;
+    }
+    else if(format == OUTPUT_RAW) {
+        stream = quiet ? stdout : fopen(output, "wb");
+        if(!stream) {
+            fprintf(stderr, "Failed to open %s\n", output);
+            result = -1;
+        }
+    }
+
+    crc_init();
+    batch_t batch = {
+        .renderers = renderers, .poses = poses, .map = &map, .sprites = sprite_count > 0 ? &sprites : NULL,
+        .slots = slots, .format = format, .output = output,
+    };
+    for(int first = 0; first < frames && result == 0; first += batch_size) {
+        int count = frames - first < batch_size ? frames - first : batch_size;
+        batch.first = first;
+        threadpool_run(pool, count, 1, render_batch, &batch);
+
+        // a stream takes the frames in order, whichever worker finished first
+        for(int i = 0; i < count; i++) {
+            checksums[slots[i].frame] = slots[i].checksum;
+            if(slots[i].failed) result = -1;
+            if(stream && fwrite(slots[i].rgb, (size_t)width * height * 3, 1, stream) != 1) {
+                fprintf(stderr, "Failed to write %s\n", output);
+                result = -1;
+            }
+        }
+    }
+    if(stream && stream != stdout && fclose(stream) != 0) result = -1;
+
+    if(result == 0) {
+        FILE *f = checksum_path ? fopen(checksum_path, "w") : NULL;
+        if(checksum_path && !f) {
+            fprintf(stderr, "Failed to open %s\n", checksum_path);
+            result = -1;
+        }
+        for(int i = 0; i < frames; i++) {
+            if(f) fprintf(f, "%d %08x\n", i, checksums[i]);
+            else if(!quiet && !golden_path) printf("%d %08x\n", i, checksums[i]);
+        }
+        if(f && fclose(f) != 0) result = -1;
+        if(golden_path && result == 0) result = compare_golden(golden_path, checksums, frames);
+    }
+
+    for(int i = 0; i < batch_size; i++) free(slots ? slots[i].rgb : NULL);
+    free(slots);
+    for(int i = 0; i < ready; i++) renderer_free(&renderers[i]);
+    free(renderers);
+    free(checksums);
+    threadpool_destroy(pool);
+    if(sprite_count > 0) {
+        sprites_free(&sprites);
+        atlas_free(&sprite_atlas);
+    }
+    atlas_free(&atlas);
+    free(poses);
+    map_free(&map);
+    return result;
+}
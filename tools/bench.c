@@ -0,0 +1,426 @@
+// Headless render benchmark. Replays an input trace through
+// handle_movement with a fixed time step and times every frame, for each
+// combination of map size, resolution, thread count and SIMD level. Each
+// combination prints one JSON line, so runs can be diffed between builds.
+//
+//   bench [-s 64,1024] [-r 640x400,1800x1200] [-j 1,4] [-i trace] [-C] [-V]
+//
+// bench -C -b 8 -I 5 -w 200 -f 700 -r 1800x1200 walks long enough to settle
+// on a level, stands still for five seconds, then walks on; min_quality
+// shows whether standing still dragged the level back down.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "atlas.h"
+#include "collision.h"
+#include "map.h"
+#include "player.h"
+#include "profiler.h"
+#include "render.h"
+#include "sprite.h"
+#include "trace.h"
+#include "utils.h"
+
+#define MAX_LIST 16
+
+static const char *simd_names[] = { "none", "sse2", "avx2" };
+
+typedef struct {
+    int frames;
+    int warmup;
+    float d_time;
+    float idle;         // seconds standing still after the warm-up
+    int verify;
+    int cache;
+    int actors;
+    int sprites;
+    float budget_ms;
+    float fov;          // degrees
+} options_t;
+
+// Actors wander in straight lines and turn a quarter when blocked, which
+// keeps them sliding along walls and exercises the collision batch.
+typedef struct {
+    bodies_t bodies;
+    float *heading_x;
+    float *heading_y;
+    float *last_x;      // positions before the tick, to spot who got stuck
+    float *last_y;
+} actors_t;
+
+static void actors_free(actors_t *actors) {
+    bodies_free(&actors->bodies);
+    free(actors->heading_x);
+    free(actors->heading_y);
+    free(actors->last_x);
+    free(actors->last_y);
+}
+
+static int actors_init(actors_t *actors, int count, const map_t *map) {
+    memset(actors, 0, sizeof(actors_t));
+    if(count == 0) return 0;
+    actors->heading_x = malloc(count * sizeof(float));
+    actors->heading_y = malloc(count * sizeof(float));
+    actors->last_x = malloc(count * sizeof(float));
+    actors->last_y = malloc(count * sizeof(float));
+    if(!actors->heading_x || !actors->heading_y || !actors->last_x || !actors->last_y ||
+       bodies_init(&actors->bodies, count) < 0) {
+        actors_free(actors);
+        return -1;
+    }
+
+    srand(7);
+    for(int i = 0; i < count; i++) {
+        int x, y;
+        do {
+            x = rand() % map->width;
+            y = rand() % map->height;
+        } while(map_is_wall(map, x, y));
+        bodies_add(&actors->bodies, (x + 0.5f) * BLOCKS_WIDTH, (y + 0.5f) * BLOCKS_HEIGHT, BLOCKS_WIDTH / 5.0f);
+
+        float angle = rand() / (float)RAND_MAX * 2 * M_PI;
+        actors->heading_x[i] = cosf(angle);
+        actors->heading_y[i] = sinf(angle);
+    }
+    return 0;
+}
+
+static void actors_step(actors_t *actors, const map_t *map, float d_time) {
+    bodies_t *bodies = &actors->bodies;
+    float distance = MOVE_SPEED * d_time;
+    for(int i = 0; i < bodies->count; i++) {
+        actors->last_x[i] = bodies->x[i];
+        actors->last_y[i] = bodies->y[i];
+        bodies->dx[i] = actors->heading_x[i] * distance;
+        bodies->dy[i] = actors->heading_y[i] * distance;
+    }
+
+    collide_bodies(bodies, map);
+
+    for(int i = 0; i < bodies->count; i++) {
+        float moved = (bodies->x[i] - actors->last_x[i]) * actors->heading_x[i] +
+                      (bodies->y[i] - actors->last_y[i]) * actors->heading_y[i];
+        if(moved < distance / 2) {
+            float turned = actors->heading_x[i];
+            actors->heading_x[i] = -actors->heading_y[i];
+            actors->heading_y[i] = turned;
+        }
+    }
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Walks, turns both ways and backs off a wall, in about eight seconds.
+static void default_trace(trace_t *trace) {
+    static const struct { double time; input_t input; } steps[] = {
+        { 0.0, { 1, 0, 0, 0 } },
+        { 1.5, { 1, 0, 1, 0 } },
+        { 2.5, { 1, 0, 0, 0 } },
+        { 4.0, { 0, 0, 0, 1 } },
+        { 5.0, { 1, 0, 0, 1 } },
+        { 6.5, { 0, 1, 0, 0 } },
+    };
+    trace_init(trace);
+    for(size_t i = 0; i < sizeof(steps) / sizeof(steps[0]); i++) trace_record(trace, steps[i].time, &steps[i].input);
+    trace_end(trace, 8.0);
+}
+
+static int parse_list(const char *text, int *values) {
+    int count = 0;
+    while(*text && count < MAX_LIST) {
+        values[count++] = atoi(text);
+        const char *comma = strchr(text, ',');
+        if(!comma) break;
+        text = comma + 1;
+    }
+    return count;
+}
+
+static int parse_resolutions(const char *text, int *widths, int *heights) {
+    int count = 0;
+    while(*text && count < MAX_LIST) {
+        if(sscanf(text, "%dx%d", &widths[count], &heights[count]) != 2 || widths[count] <= 0 || heights[count] <= 0) {
+            printf("Bad resolution %s\n", text);
+            return -1;
+        }
+        count++;
+        const char *comma = strchr(text, ',');
+        if(!comma) break;
+        text = comma + 1;
+    }
+    return count;
+}
+
+static int parse_simd(const char *text, int *levels) {
+    int count = 0;
+    while(*text && count < MAX_LIST) {
+        int level = -1;
+        for(int i = 0; i < 3; i++) {
+            size_t length = strlen(simd_names[i]);
+            if(strncmp(text, simd_names[i], length) == 0 && (text[length] == ',' || text[length] == 0)) level = i;
+        }
+        if(level < 0) {
+            printf("Bad SIMD level %s\n", text);
+            return -1;
+        }
+        levels[count++] = level;
+        const char *comma = strchr(text, ',');
+        if(!comma) break;
+        text = comma + 1;
+    }
+    return count;
+}
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static int frames_equal(const renderer_t *a, const renderer_t *b) {
+    for(int y = 0; y < a->fb.height; y++) {
+        if(memcmp(a->fb.pixels + (size_t)y * a->fb.stride, b->fb.pixels + (size_t)y * b->fb.stride, a->fb.width * 4)) return 0;
+    }
+    return 1;
+}
+
+static int run(const options_t *options, const atlas_t *atlas, const map_t *map, const sprites_t *sprites,
+               const trace_t *trace, int width, int height, int threads, int simd, int quality) {
+    renderer_t renderer, reference;
+    if(renderer_init(&renderer, atlas, width, height, threads) < 0) return -1;
+    if(options->verify && renderer_init(&reference, atlas, width, height, 1) < 0) {
+        renderer_free(&renderer);
+        return -1;
+    }
+    renderer_set_quality(&renderer, quality);
+    renderer.budget_ms = options->budget_ms;
+    renderer.fov = options->fov * (M_PI / 180);
+    renderer.cache = options->cache;
+    if(options->verify) {
+        reference.fov = renderer.fov;
+        reference.cache = 0;
+    }
+
+    actors_t actors;
+    double *times = malloc(options->frames * sizeof(double));
+    if(!times || actors_init(&actors, options->actors, map) < 0) {
+        free(times);
+        renderer_free(&renderer);
+        if(options->verify) renderer_free(&reference);
+        return -1;
+    }
+
+    player_t player = {
+        .x = map->width * BLOCKS_WIDTH / 2,
+        .y = map->height * BLOCKS_HEIGHT / 2,
+        .w = BLOCKS_WIDTH * 8 / 25,
+        .h = BLOCKS_HEIGHT * 8 / 25
+    };
+    player_set_angle(&player, M_PI);
+
+    int mismatches = 0;
+    double total = 0;
+    double actor_total = 0;
+    double reused = 0;
+    double rays = 0;
+    int min_quality = RENDER_QUALITY_LEVELS;
+    for(int frame = -options->warmup; frame < options->frames; frame++) {
+        // the trace pauses for the idle time once the warm-up is over
+        input_t input = { 0 };
+        double time = (frame + options->warmup) * (double)options->d_time;
+        double idle_end = options->warmup * (double)options->d_time + options->idle;
+        if(frame < 0 || time >= idle_end) trace_input(trace, frame < 0 ? time : time - options->idle, &input);
+
+        raycast_set_simd_level(simd);
+        profiler_frame();
+        double start = now();
+        render_frame(&renderer, &player, map, sprites);
+        double elapsed = now() - start;
+        // a skipped frame costs nothing and says nothing about the level
+        if(!renderer.unchanged) renderer_adapt(&renderer, elapsed * 1e3);
+
+        if(options->verify) {
+            renderer_set_quality(&reference, renderer.quality);
+            raycast_set_simd_level(SIMD_NONE);
+            render_frame(&reference, &player, map, sprites);
+            mismatches += !frames_equal(&renderer, &reference);
+        }
+        handle_movement(&player, &input, map, options->d_time);
+
+        start = now();
+        actors_step(&actors, map, options->d_time);
+        double actor_time = now() - start;
+
+        if(frame < 0) continue;
+        times[frame] = elapsed;
+        total += elapsed;
+        if(!renderer.unchanged && renderer.quality < min_quality) min_quality = renderer.quality;
+        reused += renderer.reused_columns;
+        rays += atomic_load_explicit(&renderer.cast_rays, memory_order_relaxed);
+        actor_total += actor_time;
+    }
+
+    raycast_set_simd_level(simd);
+    qsort(times, options->frames, sizeof(double), compare_double);
+    int frames = options->frames;
+    printf("{\"map\":\"%dx%d\",\"width\":%d,\"height\":%d,\"threads\":%d,\"simd\":\"%s\",\"frames\":%d,"
+           "\"mean_ms\":%.4f,\"p50_ms\":%.4f,\"p99_ms\":%.4f,\"max_ms\":%.4f,"
+           "\"rays_per_s\":%.0f,\"pixels_per_s\":%.0f,\"checksum\":\"%08x\"",
+        map->width, map->height, width, height, threadpool_size(renderer.pool), simd_names[raycast_simd_level()], frames,
+        total / frames * 1e3, times[frames / 2] * 1e3, times[(frames * 99) / 100] * 1e3, times[frames - 1] * 1e3,
+        rays / total, (double)width * height * frames / total, framebuffer_checksum(&renderer.fb));
+    printf(",\"quality\":%d,\"reused\":%.4f", renderer.quality, reused / ((double)width * frames));
+    if(options->budget_ms > 0) printf(",\"budget_ms\":%.2f,\"min_quality\":%d", options->budget_ms, min_quality);
+    if(options->sprites) printf(",\"sprites\":%d", sprites->count);
+    if(options->actors) printf(",\"actors\":%d,\"actor_ms\":%.4f", options->actors, actor_total / frames * 1e3);
+    if(options->verify) printf(",\"mismatches\":%d", mismatches);
+    printf("}\n");
+    fflush(stdout);
+
+    free(times);
+    actors_free(&actors);
+    renderer_free(&renderer);
+    if(options->verify) renderer_free(&reference);
+    return 0;
+}
+
+static void usage(const char *name) {
+    printf("usage: %s [options]\n", name);
+    printf("  -a atlas      wall texture atlas (default glx/textures.atlas)\n");
+    printf("  -m map        benchmark a map file instead of generated ones\n");
+    printf("  -s sizes      generated map sizes, comma separated (default 64,1024)\n");
+    printf("  -r WxH,...    resolutions (default 640x400,1800x1200)\n");
+    printf("  -j threads    thread counts, 0 = one per CPU (default 1,0)\n");
+    printf("  -x levels     SIMD levels none,sse2,avx2 (default the best supported)\n");
+    printf("  -i trace      input trace recorded with hehe -r (default a built-in walk)\n");
+    printf("  -f frames     timed frames per run (default 300)\n");
+    printf("  -w frames     untimed warm-up frames (default 20)\n");
+    printf("  -d seconds    fixed simulation step (default 1/60)\n");
+    printf("  -I seconds    stand still this long after the warm-up, then go on (default 0)\n");
+    printf("  -F fov        horizontal field of view in degrees, 0-180 (default 60)\n");
+    printf("  -q levels     dynamic resolution levels 0-%d, comma separated (default 0)\n", RENDER_QUALITY_LEVELS - 1);
+    printf("  -b ms         adapt the level to this render time budget instead\n");
+    printf("  -S sprites    sprites scattered over each map (default 0)\n");
+    printf("  -A atlas      sprite texture atlas (default glx/sprites.atlas)\n");
+    printf("  -n actors     also move this many colliding actors per frame (default 0)\n");
+    printf("  -C            keep the visibility cache on, frames that reuse it count\n");
+    printf("                only the rays they cast\n");
+    printf("  -V            also render without SIMD or cache and count differing frames\n");
+    printf("  -p file       write a Chrome trace of the last frames rendered\n");
+}
+
+int main(int argc, char **argv) {
+    options_t options = { .frames = 300, .warmup = 20, .d_time = 1 / 60.0f, .idle = 0, .verify = 0, .cache = 0, .actors = 0, .sprites = 0, .budget_ms = 0, .fov = 60 };
+    const char *atlas_path = "glx/textures.atlas";
+    const char *sprite_atlas_path = "glx/sprites.atlas";
+    const char *map_path = NULL;
+    const char *trace_path = NULL;
+    const char *profile_path = NULL;
+    int sizes[MAX_LIST] = { 64, 1024 }, size_count = 2;
+    int widths[MAX_LIST] = { 640, 1800 }, heights[MAX_LIST] = { 400, 1200 }, resolution_count = 2;
+    int threads[MAX_LIST] = { 1, 0 }, thread_count = 2;
+    int simd[MAX_LIST] = { raycast_simd_level() }, simd_count = 1;
+    int quality[MAX_LIST] = { 0 }, quality_count = 1;
+
+    int opt;
+    while((opt = getopt(argc, argv, "a:m:s:r:j:x:F:q:b:i:f:w:d:I:S:A:n:CVp:h")) != -1) {
+        switch(opt) {
+            case 'a': atlas_path = optarg; break;
+            case 'm': map_path = optarg; break;
+            case 's': size_count = parse_list(optarg, sizes); break;
+            case 'r': resolution_count = parse_resolutions(optarg, widths, heights); break;
+            case 'j': thread_count = parse_list(optarg, threads); break;
+            case 'x': simd_count = parse_simd(optarg, simd); break;
+            case 'F':
+                options.fov = strtof(optarg, NULL);
+                if(!(options.fov > 0 && options.fov < 180)) {
+                    printf("Bad field of view %s\n", optarg);
+                    return -1;
+                }
+                break;
+            case 'q': quality_count = parse_list(optarg, quality); break;
+            case 'b': options.budget_ms = strtof(optarg, NULL); break;
+            case 'i': trace_path = optarg; break;
+            case 'f': options.frames = atoi(optarg); break;
+            case 'w': options.warmup = atoi(optarg); break;
+            case 'd': options.d_time = strtof(optarg, NULL); break;
+            case 'I': options.idle = strtof(optarg, NULL); break;
+            case 'S': options.sprites = atoi(optarg); break;
+            case 'A': sprite_atlas_path = optarg; break;
+            case 'n': options.actors = atoi(optarg); break;
+            case 'C': options.cache = 1; break;
+            case 'V': options.verify = 1; break;
+            case 'p': profile_path = optarg; break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : -1;
+        }
+    }
+    if(resolution_count < 0 || simd_count < 0 || options.frames <= 0 || options.warmup < 0 || options.idle < 0) return -1;
+    if(map_path) size_count = 1;
+
+    atlas_t atlas, sprite_atlas;
+    if(atlas_load(&atlas, atlas_path) < 0) return -1;
+    if(options.sprites && atlas_load(&sprite_atlas, sprite_atlas_path) < 0) {
+        atlas_free(&atlas);
+        return -1;
+    }
+
+    trace_t trace;
+    if(trace_path) {
+        if(trace_load(&trace, trace_path) < 0) {
+            if(options.sprites) atlas_free(&sprite_atlas);
+            atlas_free(&atlas);
+            return -1;
+        }
+    }
+    else {
+        default_trace(&trace);
+    }
+
+    if(profile_path) profiler_set_enabled(1);
+
+    int result = 0;
+    for(int s = 0; s < size_count && result == 0; s++) {
+        map_t map;
+        if(map_path ? map_load(&map, map_path) < 0 : map_generate(&map, sizes[s], sizes[s], sizes[s] > 8 ? 0.05f : 0, 1) < 0) {
+            result = -1;
+            break;
+        }
+        sprites_t sprites;
+        if(options.sprites) {
+            if(sprites_init(&sprites, &sprite_atlas, &map, options.sprites) < 0) {
+                map_free(&map);
+                result = -1;
+                break;
+            }
+            sprites_scatter(&sprites, &map, options.sprites, 0, 1);
+        }
+        for(int r = 0; r < resolution_count && result == 0; r++) {
+            for(int t = 0; t < thread_count && result == 0; t++) {
+                for(int x = 0; x < simd_count && result == 0; x++) {
+                    for(int q = 0; q < quality_count && result == 0; q++) {
+                        result = run(&options, &atlas, &map, options.sprites ? &sprites : NULL, &trace,
+                                     widths[r], heights[r], threads[t], simd[x], quality[q]);
+                    }
+                }
+            }
+        }
+        if(options.sprites) sprites_free(&sprites);
+        map_free(&map);
+    }
+
+    if(profile_path && result == 0) result = profiler_export(profile_path);
+    trace_free(&trace);
+    if(options.sprites) atlas_free(&sprite_atlas);
+    atlas_free(&atlas);
+    return result;
+}
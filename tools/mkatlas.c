@@ -0,0 +1,208 @@
+// Packs PPM (P6) and PAM (P7) images into a texture atlas with a full mip
+// chain per texture. Texture n in the atlas is wall type n + 1.
+//
+//   mkatlas out.atlas wall_01.ppm wall_02.ppm ...
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "atlas.h"
+
+typedef struct {
+    int width, height, levels;
+    uint8_t *level[ATLAS_MAX_LEVELS];   // RGBA8
+    uint32_t offset[ATLAS_MAX_LEVELS];
+} image_t;
+
+static int read_token(FILE *file, char *token, int size) {
+    int c = fgetc(file);
+    while(c == '#' || c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+        if(c == '#') while(c != '\n' && c != EOF) c = fgetc(file);
+        c = fgetc(file);
+    }
+
+    int n = 0;
+    while(c != EOF && c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+        if(n < size - 1) token[n++] = c;
+        c = fgetc(file);
+    }
+    token[n] = 0;
+    return n > 0 ? 0 : -1;
+}
+
+// Reads the header up to the first pixel byte, returns channels per pixel.
+static int read_header(FILE *file, int *width, int *height) {
+    char token[32];
+    if(read_token(file, token, sizeof(token)) < 0) return -1;
+
+    int depth = 3, maxval = 0;
+    if(strcmp(token, "P6") == 0) {
+        if(read_token(file, token, sizeof(token)) < 0) return -1;
+        *width = atoi(token);
+        if(read_token(file, token, sizeof(token)) < 0) return -1;
+        *height = atoi(token);
+        if(read_token(file, token, sizeof(token)) < 0) return -1;
+        maxval = atoi(token);
+    }
+    else if(strcmp(token, "P7") == 0) {
+        while(read_token(file, token, sizeof(token)) == 0 && strcmp(token, "ENDHDR") != 0) {
+            char value[32];
+            if(read_token(file, value, sizeof(value)) < 0) return -1;
+            if(strcmp(token, "WIDTH") == 0) *width = atoi(value);
+            else if(strcmp(token, "HEIGHT") == 0) *height = atoi(value);
+            else if(strcmp(token, "DEPTH") == 0) depth = atoi(value);
+            else if(strcmp(token, "MAXVAL") == 0) maxval = atoi(value);
+        }
+    }
+    else {
+        return -1;
+    }
+
+    if(maxval != 255 || (depth != 3 && depth != 4)) return -1;
+    return depth;
+}
+
+static int is_pow2(int value) {
+    return value > 0 && (value & (value - 1)) == 0;
+}
+
+static int load_image(image_t *image, const char *path) {
+    FILE *file = fopen(path, "rb");
+    if(!file) {
+        printf("Failed to open %s\n", path);
+        return -1;
+    }
+
+    int width = 0, height = 0;
+    int depth = read_header(file, &width, &height);
+    if(depth < 0 || !is_pow2(width) || !is_pow2(height) || width > 32768 || height > 32768) {
+        printf("%s is not a power of two sized 8-bit PPM or PAM image\n", path);
+        fclose(file);
+        return -1;
+    }
+
+    size_t pixels = (size_t)width * height;
+    uint8_t *rgba = malloc(pixels * 4);
+    if(!rgba) {
+        fclose(file);
+        return -1;
+    }
+    for(size_t i = 0; i < pixels; i++) {
+        uint8_t pixel[4] = { 0, 0, 0, 255 };
+        if(fread(pixel, 1, depth, file) != (size_t)depth) {
+            printf("%s is truncated\n", path);
+            free(rgba);
+            fclose(file);
+            return -1;
+        }
+        memcpy(rgba + i * 4, pixel, 4);
+    }
+    fclose(file);
+
+    image->width = width;
+    image->height = height;
+    image->level[0] = rgba;
+    image->levels = 1;
+    return 0;
+}
+
+// Each level averages 2x2 blocks of the one above until a side reaches 1.
+static int build_mips(image_t *image) {
+    while(image->levels < ATLAS_MAX_LEVELS) {
+        int w = image->width >> image->levels;
+        int h = image->height >> image->levels;
+        if(w < 1 || h < 1) break;
+
+        const uint8_t *src = image->level[image->levels - 1];
+        uint8_t *dst = malloc((size_t)w * h * 4);
+        if(!dst) return -1;
+
+        int src_w = w * 2;
+        for(int y = 0; y < h; y++) {
+            for(int x = 0; x < w; x++) {
+                const uint8_t *a = src + ((size_t)(y * 2) * src_w + x * 2) * 4;
+                const uint8_t *b = a + (size_t)src_w * 4;
+                for(int c = 0; c < 4; c++) {
+                    dst[((size_t)y * w + x) * 4 + c] = (a[c] + a[c + 4] + b[c] + b[c + 4] + 2) / 4;
+                }
+            }
+        }
+        image->level[image->levels++] = dst;
+    }
+    return 0;
+}
+
+static void write_u32(FILE *file, uint32_t value) {
+    uint8_t bytes[4] = { value, value >> 8, value >> 16, value >> 24 };
+    fwrite(bytes, 1, 4, file);
+}
+
+int main(int argc, char **argv) {
+    if(argc < 3) {
+        printf("usage: %s out.atlas image...\n", argv[0]);
+        return -1;
+    }
+
+    int count = argc - 2;
+    if(count > 255) {
+        printf("At most 255 textures fit in an atlas\n");
+        return -1;
+    }
+
+    image_t *images = calloc(count, sizeof(image_t));
+    if(!images) return -1;
+    for(int i = 0; i < count; i++) {
+        if(load_image(&images[i], argv[i + 2]) < 0 || build_mips(&images[i]) < 0) return -1;
+    }
+
+    // coarse levels of every texture first, full size levels last
+    uint32_t offset = 0;
+    for(int level = ATLAS_MAX_LEVELS - 1; level >= 0; level--) {
+        for(int i = 0; i < count; i++) {
+            if(level >= images[i].levels) continue;
+            images[i].offset[level] = offset;
+            offset += (images[i].width >> level) * (images[i].height >> level);
+        }
+    }
+
+    FILE *file = fopen(argv[1], "wb");
+    if(!file) {
+        printf("Failed to create %s\n", argv[1]);
+        return -1;
+    }
+
+    uint32_t data = (16 + count * (3 + ATLAS_MAX_LEVELS) * 4 + 63) / 64 * 64;
+    fwrite(ATLAS_MAGIC, 1, 4, file);
+    write_u32(file, ATLAS_VERSION);
+    write_u32(file, count);
+    write_u32(file, data);
+    for(int i = 0; i < count; i++) {
+        write_u32(file, images[i].width);
+        write_u32(file, images[i].height);
+        write_u32(file, images[i].levels);
+        for(int level = 0; level < ATLAS_MAX_LEVELS; level++) {
+            write_u32(file, level < images[i].levels ? images[i].offset[level] : 0);
+        }
+    }
+    while(ftell(file) < (long)data) fputc(0, file);
+
+    for(int level = ATLAS_MAX_LEVELS - 1; level >= 0; level--) {
+        for(int i = 0; i < count; i++) {
+            if(level >= images[i].levels) continue;
+            size_t size = (size_t)(images[i].width >> level) * (images[i].height >> level) * 4;
+            fwrite(images[i].level[level], 1, size, file);
+        }
+    }
+
+    for(int i = 0; i < count; i++) {
+        for(int level = 0; level < images[i].levels; level++) free(images[i].level[level]);
+    }
+    free(images);
+
+    if(fclose(file) != 0) {
+        printf("Failed to write %s\n", argv[1]);
+        return -1;
+    }
+    return 0;
+}